@@ -7,8 +7,10 @@
 
 # SDP library source files.
 set( SDP_SOURCES
+     "${CMAKE_CURRENT_LIST_DIR}/source/sdp_arena.c"
      "${CMAKE_CURRENT_LIST_DIR}/source/sdp_deserializer.c"
-     "${CMAKE_CURRENT_LIST_DIR}/source/sdp_serializer.c" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/sdp_serializer.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/sdp_session_view.c" )
 
 # SDP library public include directories.
 set( SDP_INCLUDE_PUBLIC_DIRS
@@ -16,7 +18,9 @@ set( SDP_INCLUDE_PUBLIC_DIRS
 
 # SDP library public include header files.
 set( SDP_INCLUDE_PUBLIC_FILES
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_arena.h"
      "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_config_defaults.h"
      "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_data_types.h"
      "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_deserializer.h"
-     "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_serializer.h" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_serializer.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/sdp_session_view.h" )
@@ -0,0 +1,49 @@
+#ifndef SDP_ARENA_H
+#define SDP_ARENA_H
+
+#include "sdp_data_types.h"
+
+/* Called when the arena runs out of space. Return a block of at least
+ * blockLength bytes, or NULL to fail the allocation. Blocks are owned by the
+ * caller and must stay valid until the arena is reset. */
+typedef void * ( * SdpArenaGrowCallback_t )( void * pGrowContext,
+                                             size_t blockLength );
+
+typedef struct SdpArena
+{
+    uint8_t * pInitialBuffer;
+    size_t initialBufferLength;
+    uint8_t * pBuffer;
+    size_t bufferLength;
+    size_t used;
+    SdpArenaGrowCallback_t growCallback;
+    void * pGrowContext;
+} SdpArena_t;
+
+/*-----------------------------------------------------------*/
+
+/* Initialize a bump allocator over pBuffer. If pBuffer is NULL and
+ * bufferLength is 0, the static region of SDP_ARENA_STATIC_BUFFER_SIZE bytes
+ * is used, or no initial buffer at all when that size is 0. growCallback is
+ * optional.
+ *
+ * The static region is a single global buffer: at most one arena may use it
+ * at a time, and it is not thread-safe. Arenas used by different threads
+ * need their own buffers. */
+SdpResult_t SdpArena_Init( SdpArena_t * pArena,
+                           void * pBuffer,
+                           size_t bufferLength,
+                           SdpArenaGrowCallback_t growCallback,
+                           void * pGrowContext );
+
+/* Allocate size bytes aligned to SDP_ARENA_ALIGNMENT. */
+SdpResult_t SdpArena_Allocate( SdpArena_t * pArena,
+                               size_t size,
+                               void ** ppMemory );
+
+/* Free every allocation at once and return to the initial buffer. */
+SdpResult_t SdpArena_Reset( SdpArena_t * pArena );
+
+/*-----------------------------------------------------------*/
+
+#endif /* SDP_ARENA_H */
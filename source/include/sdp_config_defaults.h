@@ -28,4 +28,80 @@
     #define SDP_PRINT_FMT_UINT16        "hu"
 #endif
 
+/**
+ * @brief Use SIMD instructions (SSE2/AVX2 on x86-64, NEON on aarch64) to
+ * search the message when the compiler targets them. Set to 0 to always use
+ * the portable scalar code.
+ */
+#ifndef SDP_USE_SIMD
+    #define SDP_USE_SIMD                1
+#endif
+
+/**
+ * @brief Alignment, in bytes, of every allocation made from an SdpArena_t.
+ */
+#ifndef SDP_ARENA_ALIGNMENT
+    #define SDP_ARENA_ALIGNMENT         8U
+#endif
+
+/**
+ * @brief Size, in bytes, of a static region that SdpArena_Init uses when it
+ * is given no buffer. Embedded builds can set this to parse into a fixed
+ * memory region. 0 disables the static region.
+ */
+#ifndef SDP_ARENA_STATIC_BUFFER_SIZE
+    #define SDP_ARENA_STATIC_BUFFER_SIZE    0
+#endif
+
+/**
+ * @brief Maximum number of extension name/value pairs that
+ * SdpDeserializer_ParseIceCandidate stores for one candidate.
+ */
+#ifndef SDP_ICE_CANDIDATE_MAX_EXTENSIONS
+    #define SDP_ICE_CANDIDATE_MAX_EXTENSIONS    8
+#endif
+
+/**
+ * @brief Maximum number of SSRCs that SdpDeserializer_ParseSsrcGroup stores
+ * for one group.
+ */
+#ifndef SDP_SSRC_GROUP_MAX_SSRCS
+    #define SDP_SSRC_GROUP_MAX_SSRCS    8
+#endif
+
+/**
+ * @brief Size, in bytes, of the buffer in SdpSegmentDeserializerContext_t
+ * that holds a line split across two segments. It must fit the longest line
+ * of a message, including its line ending.
+ */
+#ifndef SDP_SEGMENT_STITCH_BUFFER_LENGTH
+    #define SDP_SEGMENT_STITCH_BUFFER_LENGTH    256
+#endif
+
+/**
+ * @brief Set to 1 when every message given to the deserializer and every
+ * struct given to the serializer is known to be well formed, such as SDPs
+ * produced by this library. Parameter checks and the '=' and empty value
+ * checks of SdpDeserializer_GetNext are then compiled out, and malformed
+ * input is undefined behavior. Input and output buffer bounds are always
+ * checked.
+ *
+ * The serializer then also uses the string lengths it is given as they are,
+ * without looking for a NULL terminator inside them. A string with an
+ * embedded NULL character is written in full instead of being cut at the
+ * NULL character.
+ */
+#ifndef SDP_TRUSTED_INPUT
+    #define SDP_TRUSTED_INPUT    0
+#endif
+
+/**
+ * @brief Evaluate an input check, or nothing when SDP_TRUSTED_INPUT is set.
+ */
+#if ( SDP_TRUSTED_INPUT != 0 )
+    #define SDP_CHECK_INPUT( condition )    ( 0 )
+#else
+    #define SDP_CHECK_INPUT( condition )    ( condition )
+#endif
+
 #endif /* SDP_CONFIG_DEFAULTS_H */
@@ -24,6 +24,9 @@
 #define SDP_TYPE_MEDIA           'm'
 #define SDP_TYPE_MEDIA_TITLE     'i'
 
+/* Length of the longest digest, SHA-512, in an "a=fingerprint" attribute. */
+#define SDP_FINGERPRINT_MAX_DIGEST_LENGTH    ( 64 )
+
 /*-----------------------------------------------------------*/
 
 typedef enum SdpResult
@@ -48,7 +51,15 @@ typedef enum SdpResult
     SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORT,
     SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORTNUM,
     SDP_RESULT_OUT_OF_MEMORY,
-    SDP_RESULT_SNPRINTF_ERROR
+    SDP_RESULT_SNPRINTF_ERROR,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT,
+    SDP_RESULT_FINGERPRINT_MISMATCH,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTCP_FB,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_EXTMAP,
+    SDP_RESULT_MESSAGE_MALFORMED_INVALID_SSRC
 } SdpResult_t;
 
 typedef enum SdpNetworkType
@@ -64,6 +75,98 @@ typedef enum SdpAddressType
     SDP_ADDRESS_UNKNOWN,
 } SdpAddressType_t;
 
+typedef enum SdpIceCandidateType
+{
+    SDP_ICE_CANDIDATE_TYPE_HOST,
+    SDP_ICE_CANDIDATE_TYPE_SRFLX,
+    SDP_ICE_CANDIDATE_TYPE_PRFLX,
+    SDP_ICE_CANDIDATE_TYPE_RELAY,
+    SDP_ICE_CANDIDATE_TYPE_UNKNOWN,
+} SdpIceCandidateType_t;
+
+/* Hash functions from the RFC 8122 registry. */
+typedef enum SdpFingerprintHash
+{
+    SDP_FINGERPRINT_HASH_SHA_1,
+    SDP_FINGERPRINT_HASH_SHA_224,
+    SDP_FINGERPRINT_HASH_SHA_256,
+    SDP_FINGERPRINT_HASH_SHA_384,
+    SDP_FINGERPRINT_HASH_SHA_512,
+    SDP_FINGERPRINT_HASH_MD5,
+    SDP_FINGERPRINT_HASH_MD2,
+    SDP_FINGERPRINT_HASH_UNKNOWN,
+} SdpFingerprintHash_t;
+
+typedef enum SdpExtMapDirection
+{
+    SDP_EXTMAP_DIRECTION_NONE,
+    SDP_EXTMAP_DIRECTION_SENDRECV,
+    SDP_EXTMAP_DIRECTION_SENDONLY,
+    SDP_EXTMAP_DIRECTION_RECVONLY,
+    SDP_EXTMAP_DIRECTION_INACTIVE,
+} SdpExtMapDirection_t;
+
+/* Attribute names from the RFC 8866, JSEP and WebRTC registries. */
+typedef enum SdpAttributeKind
+{
+    SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_CAT,
+    SDP_ATTRIBUTE_KIND_KEYWDS,
+    SDP_ATTRIBUTE_KIND_TOOL,
+    SDP_ATTRIBUTE_KIND_PTIME,
+    SDP_ATTRIBUTE_KIND_MAXPTIME,
+    SDP_ATTRIBUTE_KIND_RTPMAP,
+    SDP_ATTRIBUTE_KIND_RECVONLY,
+    SDP_ATTRIBUTE_KIND_SENDRECV,
+    SDP_ATTRIBUTE_KIND_SENDONLY,
+    SDP_ATTRIBUTE_KIND_INACTIVE,
+    SDP_ATTRIBUTE_KIND_ORIENT,
+    SDP_ATTRIBUTE_KIND_TYPE,
+    SDP_ATTRIBUTE_KIND_CHARSET,
+    SDP_ATTRIBUTE_KIND_SDPLANG,
+    SDP_ATTRIBUTE_KIND_LANG,
+    SDP_ATTRIBUTE_KIND_FRAMERATE,
+    SDP_ATTRIBUTE_KIND_QUALITY,
+    SDP_ATTRIBUTE_KIND_FMTP,
+    SDP_ATTRIBUTE_KIND_ICE_UFRAG,
+    SDP_ATTRIBUTE_KIND_ICE_PWD,
+    SDP_ATTRIBUTE_KIND_ICE_OPTIONS,
+    SDP_ATTRIBUTE_KIND_ICE_LITE,
+    SDP_ATTRIBUTE_KIND_ICE_MISMATCH,
+    SDP_ATTRIBUTE_KIND_ICE_PACING,
+    SDP_ATTRIBUTE_KIND_CANDIDATE,
+    SDP_ATTRIBUTE_KIND_REMOTE_CANDIDATES,
+    SDP_ATTRIBUTE_KIND_END_OF_CANDIDATES,
+    SDP_ATTRIBUTE_KIND_FINGERPRINT,
+    SDP_ATTRIBUTE_KIND_SETUP,
+    SDP_ATTRIBUTE_KIND_CONNECTION,
+    SDP_ATTRIBUTE_KIND_MID,
+    SDP_ATTRIBUTE_KIND_GROUP,
+    SDP_ATTRIBUTE_KIND_MSID,
+    SDP_ATTRIBUTE_KIND_MSID_SEMANTIC,
+    SDP_ATTRIBUTE_KIND_SSRC,
+    SDP_ATTRIBUTE_KIND_SSRC_GROUP,
+    SDP_ATTRIBUTE_KIND_RTCP,
+    SDP_ATTRIBUTE_KIND_RTCP_MUX,
+    SDP_ATTRIBUTE_KIND_RTCP_MUX_ONLY,
+    SDP_ATTRIBUTE_KIND_RTCP_RSIZE,
+    SDP_ATTRIBUTE_KIND_RTCP_FB,
+    SDP_ATTRIBUTE_KIND_EXTMAP,
+    SDP_ATTRIBUTE_KIND_EXTMAP_ALLOW_MIXED,
+    SDP_ATTRIBUTE_KIND_RID,
+    SDP_ATTRIBUTE_KIND_SIMULCAST,
+    SDP_ATTRIBUTE_KIND_SCTP_PORT,
+    SDP_ATTRIBUTE_KIND_MAX_MESSAGE_SIZE,
+    SDP_ATTRIBUTE_KIND_SCTPMAP,
+    SDP_ATTRIBUTE_KIND_CRYPTO,
+    SDP_ATTRIBUTE_KIND_IDENTITY,
+    SDP_ATTRIBUTE_KIND_BUNDLE_ONLY,
+    SDP_ATTRIBUTE_KIND_LABEL,
+    SDP_ATTRIBUTE_KIND_CONTENT,
+    SDP_ATTRIBUTE_KIND_TLS_ID,
+    SDP_ATTRIBUTE_KIND_COUNT
+} SdpAttributeKind_t;
+
 /*-----------------------------------------------------------*/
 
 typedef struct SdpConnectionInfo
@@ -116,6 +219,138 @@ typedef struct SdpMedia
     size_t fmtLength;
 } SdpMedia_t;
 
+typedef struct SdpIceCandidateExtension
+{
+    const char * pName;
+    size_t nameLength;
+    const char * pValue;
+    size_t valueLength;
+} SdpIceCandidateExtension_t;
+
+typedef struct SdpIceCandidate
+{
+    const char * pFoundation;
+    size_t foundationLength;
+    uint16_t componentId;
+    const char * pTransport;
+    size_t transportLength;
+    uint32_t priority;
+    const char * pAddress;
+    size_t addressLength;
+    uint16_t port;
+    SdpIceCandidateType_t candidateType;
+    const char * pRelatedAddress; /* NULL if there is no "raddr". */
+    size_t relatedAddressLength;
+    uint16_t relatedPort;
+    const char * pTcpType; /* NULL if there is no "tcptype". */
+    size_t tcpTypeLength;
+    SdpIceCandidateExtension_t extensions[ SDP_ICE_CANDIDATE_MAX_EXTENSIONS ];
+    size_t extensionCount;
+} SdpIceCandidate_t;
+
+typedef struct SdpRtpMap
+{
+    uint8_t payloadType;
+    const char * pEncodingName;
+    size_t encodingNameLength;
+    uint32_t clockRate;
+    uint16_t channels; /* 0 if there are no encoding parameters. */
+} SdpRtpMap_t;
+
+typedef struct SdpFmtp
+{
+    uint8_t payloadType;
+    const char * pParameters;
+    size_t parametersLength;
+} SdpFmtp_t;
+
+typedef struct SdpFmtpParameter
+{
+    const char * pKey;
+    size_t keyLength;
+    const char * pValue; /* NULL if there is no '='. */
+    size_t valueLength;
+} SdpFmtpParameter_t;
+
+typedef struct SdpFingerprint
+{
+    SdpFingerprintHash_t hashFunction;
+    const char * pHashName;
+    size_t hashNameLength;
+    uint8_t digest[ SDP_FINGERPRINT_MAX_DIGEST_LENGTH ];
+    size_t digestLength;
+} SdpFingerprint_t;
+
+typedef struct SdpRtcpFeedback
+{
+    uint8_t payloadType;
+    uint8_t allPayloadTypes; /* 1 for "*". payloadType is then 0. */
+    const char * pType;
+    size_t typeLength;
+    const char * pParameter; /* NULL if there is no parameter. */
+    size_t parameterLength;
+} SdpRtcpFeedback_t;
+
+typedef struct SdpExtMap
+{
+    uint16_t id;
+    SdpExtMapDirection_t direction;
+    const char * pUri;
+    size_t uriLength;
+    const char * pExtensionAttributes; /* NULL if there are none. */
+    size_t extensionAttributesLength;
+} SdpExtMap_t;
+
+typedef struct SdpSsrc
+{
+    uint32_t ssrc;
+    const char * pAttributeName;
+    size_t attributeNameLength;
+    const char * pAttributeValue; /* NULL if there is no ':'. */
+    size_t attributeValueLength;
+} SdpSsrc_t;
+
+typedef struct SdpSsrcGroup
+{
+    const char * pSemantics;
+    size_t semanticsLength;
+    uint32_t ssrcs[ SDP_SSRC_GROUP_MAX_SSRCS ];
+    size_t ssrcCount;
+} SdpSsrcGroup_t;
+
+typedef struct SdpMediaDescription
+{
+    SdpMedia_t media;
+    const char * pMediaTitle;
+    size_t mediaTitleLength;
+    SdpConnectionInfo_t * pConnectionInfos;
+    size_t connectionInfoCount;
+    SdpBandwidthInfo_t * pBandwidthInfos;
+    size_t bandwidthInfoCount;
+    SdpAttribute_t * pAttributes;
+    size_t attributeCount;
+} SdpMediaDescription_t;
+
+typedef struct SdpSessionDescription
+{
+    uint32_t version;
+    SdpOriginator_t originator;
+    const char * pSessionName;
+    size_t sessionNameLength;
+    const char * pSessionInfo;
+    size_t sessionInfoLength;
+    SdpConnectionInfo_t * pConnectionInfos;
+    size_t connectionInfoCount;
+    SdpBandwidthInfo_t * pBandwidthInfos;
+    size_t bandwidthInfoCount;
+    SdpTimeDescription_t * pTimeDescriptions;
+    size_t timeDescriptionCount;
+    SdpAttribute_t * pAttributes;
+    size_t attributeCount;
+    SdpMediaDescription_t * pMediaDescriptions;
+    size_t mediaDescriptionCount;
+} SdpSessionDescription_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* SDP_DATA_TYPES_H */
@@ -2,6 +2,7 @@
 #define SDP_DESERIALIZER_H
 
 #include "sdp_data_types.h"
+#include "sdp_arena.h"
 
 typedef struct SdpDeserializerContext
 {
@@ -10,6 +11,184 @@ typedef struct SdpDeserializerContext
     size_t currentIndex;
 } SdpDeserializerContext_t;
 
+/* Context for a message that arrives in chunks. Only the partial line at the
+ * end of a chunk is copied, into the caller-provided carry buffer. */
+typedef struct SdpStreamDeserializerContext
+{
+    char * pCarryBuffer;
+    size_t carryBufferLength;
+    size_t carryLength;
+    const char * pChunk;
+    size_t chunkLength;
+    size_t chunkIndex;
+} SdpStreamDeserializerContext_t;
+
+/* One piece of a message held in non-contiguous memory. */
+typedef struct SdpBufferSegment
+{
+    const char * pBuffer;
+    size_t bufferLength;
+} SdpBufferSegment_t;
+
+/* Context for a message spread over several segments, such as receive
+ * buffers from a pool or the two halves of a wrapped ring buffer. */
+typedef struct SdpSegmentDeserializerContext
+{
+    SdpStreamDeserializerContext_t streamContext;
+    const SdpBufferSegment_t * pSegments;
+    size_t segmentCount;
+    size_t segmentIndex;
+    SdpBufferSegment_t ringSegments[ 2 ];
+    char stitchBuffer[ SDP_SEGMENT_STITCH_BUFFER_LENGTH ];
+} SdpSegmentDeserializerContext_t;
+
+/* Location of one "<type>=<value>" line, relative to pStart of the
+ * deserializer context it was indexed from. */
+typedef struct SdpLineInfo
+{
+    uint8_t type;
+    size_t valueOffset;
+    size_t valueLength;
+} SdpLineInfo_t;
+
+/* Extent of one media section, from its "m=" line to the next "m=" line or
+ * the end of the message, relative to pStart of the deserializer context it
+ * was indexed from, and the number of lines of each kind in it. */
+typedef struct SdpMediaSectionInfo
+{
+    size_t startOffset;
+    size_t endOffset;
+    size_t attributeCount;
+    size_t bandwidthInfoCount;
+    size_t connectionInfoCount;
+    size_t candidateCount; /* "a=candidate" lines, also in attributeCount. */
+} SdpMediaSectionInfo_t;
+
+/* A line prefix to look for with SdpDeserializer_ScanPrefixes, including the
+ * type, e.g. "a=ice-ufrag:". */
+typedef struct SdpScanPattern
+{
+    const char * pPrefix;
+    size_t prefixLength;
+} SdpScanPattern_t;
+
+/* A line found by SdpDeserializer_ScanPrefixes. The line and the value, i.e.
+ * the rest of the line after the prefix, exclude the line ending. */
+typedef struct SdpScanMatch
+{
+    size_t patternIndex;
+    const char * pLine;
+    size_t lineLength;
+    const char * pValue;
+    size_t valueLength;
+} SdpScanMatch_t;
+
+/* Caller-provided arrays that SdpDeserializer_ParseSession fills. The
+ * session and each media description point to consecutive runs of entries
+ * in these arrays. */
+typedef struct SdpSessionStorage
+{
+    SdpMediaDescription_t * pMediaDescriptions;
+    size_t mediaDescriptionsLength;
+    SdpAttribute_t * pAttributes;
+    size_t attributesLength;
+    SdpConnectionInfo_t * pConnectionInfos;
+    size_t connectionInfosLength;
+    SdpBandwidthInfo_t * pBandwidthInfos;
+    size_t bandwidthInfosLength;
+    SdpTimeDescription_t * pTimeDescriptions;
+    size_t timeDescriptionsLength;
+} SdpSessionStorage_t;
+
+/* One message of a batch. pMessage, messageLength and pArena are set by the
+ * caller; session and result are written by SdpDeserializer_ParseBatch. Each
+ * slot needs its own arena with its own buffer; the static region of
+ * SdpArena_Init can back at most one of them and is not thread-safe. */
+typedef struct SdpBatchSlot
+{
+    const char * pMessage;
+    size_t messageLength;
+    SdpArena_t * pArena;
+    SdpSessionDescription_t session;
+    SdpResult_t result;
+} SdpBatchSlot_t;
+
+/* mediaIndex passed to SdpVisitor_t callbacks for lines before the first
+ * "m=" line. */
+#define SDP_WALK_SESSION_LEVEL    ( SIZE_MAX )
+
+/* Callbacks of SdpDeserializer_Walk, each called with the typed result of the
+ * matching Parse* function. Every callback is optional: a line whose callback
+ * is NULL is not parsed. An attribute with a typed callback that is NULL goes
+ * to onAttribute. mediaIndex is the index of the current media section, or
+ * SDP_WALK_SESSION_LEVEL. Returning anything but SDP_RESULT_OK stops the walk
+ * with that result, except SDP_RESULT_MESSAGE_END, which stops it with
+ * SDP_RESULT_OK. */
+typedef struct SdpVisitor
+{
+    SdpResult_t ( * onOriginator )( void * pUserContext,
+                                    const SdpOriginator_t * pOriginator );
+    SdpResult_t ( * onTimeActive )( void * pUserContext,
+                                    const SdpTimeDescription_t * pTimeDescription );
+    SdpResult_t ( * onConnectionInfo )( void * pUserContext,
+                                        size_t mediaIndex,
+                                        const SdpConnectionInfo_t * pConnInfo );
+    SdpResult_t ( * onBandwidthInfo )( void * pUserContext,
+                                       size_t mediaIndex,
+                                       const SdpBandwidthInfo_t * pBandwidthInfo );
+    SdpResult_t ( * onMedia )( void * pUserContext,
+                               size_t mediaIndex,
+                               const SdpMedia_t * pMedia );
+    SdpResult_t ( * onAttribute )( void * pUserContext,
+                                   size_t mediaIndex,
+                                   SdpAttributeKind_t kind,
+                                   const SdpAttribute_t * pAttribute );
+    SdpResult_t ( * onCandidate )( void * pUserContext,
+                                   size_t mediaIndex,
+                                   const SdpIceCandidate_t * pCandidate );
+    SdpResult_t ( * onRtpMap )( void * pUserContext,
+                                size_t mediaIndex,
+                                const SdpRtpMap_t * pRtpMap );
+    SdpResult_t ( * onFmtp )( void * pUserContext,
+                              size_t mediaIndex,
+                              const SdpFmtp_t * pFmtp );
+    SdpResult_t ( * onFingerprint )( void * pUserContext,
+                                     size_t mediaIndex,
+                                     const SdpFingerprint_t * pFingerprint );
+    SdpResult_t ( * onRtcpFeedback )( void * pUserContext,
+                                      size_t mediaIndex,
+                                      const SdpRtcpFeedback_t * pRtcpFeedback );
+    SdpResult_t ( * onExtMap )( void * pUserContext,
+                                size_t mediaIndex,
+                                const SdpExtMap_t * pExtMap );
+    SdpResult_t ( * onSsrc )( void * pUserContext,
+                              size_t mediaIndex,
+                              const SdpSsrc_t * pSsrc );
+    SdpResult_t ( * onSsrcGroup )( void * pUserContext,
+                                   size_t mediaIndex,
+                                   const SdpSsrcGroup_t * pSsrcGroup );
+    /* Lines without a typed parser, e.g. "v=", "s=" and "i=". */
+    SdpResult_t ( * onLine )( void * pUserContext,
+                              size_t mediaIndex,
+                              uint8_t type,
+                              const char * pValue,
+                              size_t valueLength );
+} SdpVisitor_t;
+
+/* Bit of a line type, 'a' to 'z', in SdpParseMask_t.lineTypes. */
+#define SDP_LINE_TYPE_BIT( type )         ( ( uint32_t ) 1U << ( ( uint32_t ) ( type ) - ( uint32_t ) 'a' ) )
+
+/* Bit of an SdpAttributeKind_t in SdpParseMask_t.attributeKinds. */
+#define SDP_ATTRIBUTE_KIND_BIT( kind )    ( ( uint64_t ) 1U << ( uint32_t ) ( kind ) )
+
+/* Lines that SdpDeserializer_WalkSelected visits. "a=" lines are selected by
+ * attributeKinds alone; the "a" bit of lineTypes is ignored. */
+typedef struct SdpParseMask
+{
+    uint32_t lineTypes;
+    uint64_t attributeKinds;
+} SdpParseMask_t;
+
 /*-----------------------------------------------------------*/
 
 SdpResult_t SdpDeserializer_Init( SdpDeserializerContext_t * pCtx,
@@ -21,6 +200,93 @@ SdpResult_t SdpDeserializer_GetNext( SdpDeserializerContext_t * pCtx,
                                      const char ** pValue,
                                      size_t * pValueLength );
 
+/* Start a streaming parse. The carry buffer must hold the longest line of the
+ * message, including its line ending. */
+SdpResult_t SdpDeserializer_StreamInit( SdpStreamDeserializerContext_t * pCtx,
+                                        char * pCarryBuffer,
+                                        size_t carryBufferLength );
+
+/* Provide the next chunk. The previous chunk must have been consumed by
+ * SdpDeserializer_StreamGetNext returning SDP_RESULT_MESSAGE_END. The chunk
+ * must stay valid until then. */
+SdpResult_t SdpDeserializer_StreamFeed( SdpStreamDeserializerContext_t * pCtx,
+                                        const char * pChunk,
+                                        size_t chunkLength );
+
+/* Same as SdpDeserializer_GetNext for the chunks fed so far.
+ * SDP_RESULT_MESSAGE_END means that no complete line is left in the current
+ * chunk. A line that spans chunks points into the carry buffer and is valid
+ * until the next call; other lines point into the chunk.
+ * SDP_RESULT_OUT_OF_MEMORY is returned if a line does not fit in the carry
+ * buffer. */
+SdpResult_t SdpDeserializer_StreamGetNext( SdpStreamDeserializerContext_t * pCtx,
+                                           uint8_t * pType,
+                                           const char ** pValue,
+                                           size_t * pValueLength );
+
+/* Call after the last chunk. Returns the error SdpDeserializer_GetNext would
+ * for bytes left without a line ending, or SDP_RESULT_OK if there are none. */
+SdpResult_t SdpDeserializer_StreamFinish( const SdpStreamDeserializerContext_t * pCtx );
+
+/* Start parsing a message made of segmentCount segments, in order. The
+ * segments must stay valid while the context is used. */
+SdpResult_t SdpDeserializer_InitSegments( SdpSegmentDeserializerContext_t * pCtx,
+                                          const SdpBufferSegment_t * pSegments,
+                                          size_t segmentCount );
+
+/* Start parsing a message of messageLength bytes stored in a ring buffer of
+ * bufferLength bytes, beginning at readIndex and wrapping to the start of
+ * the buffer if needed. */
+SdpResult_t SdpDeserializer_InitRingBuffer( SdpSegmentDeserializerContext_t * pCtx,
+                                            const char * pBuffer,
+                                            size_t bufferLength,
+                                            size_t readIndex,
+                                            size_t messageLength );
+
+/* Same as SdpDeserializer_GetNext for a segmented message. A line split
+ * across segments is copied into the stitch buffer of the context and is
+ * valid until the next call; other lines point into the segments.
+ * SDP_RESULT_OUT_OF_MEMORY is returned if a split line is longer than
+ * SDP_SEGMENT_STITCH_BUFFER_LENGTH. */
+SdpResult_t SdpDeserializer_GetNextFromSegments( SdpSegmentDeserializerContext_t * pCtx,
+                                                 uint8_t * pType,
+                                                 const char ** pValue,
+                                                 size_t * pValueLength );
+
+/* Index every line from the current position to the end of the message in a
+ * single pass without moving the context. If pLines is NULL, only the lines
+ * are counted. If more than maxLines lines are present, SDP_RESULT_OUT_OF_MEMORY
+ * is returned and *pLineCount is the number of lines needed. */
+SdpResult_t SdpDeserializer_IndexLines( const SdpDeserializerContext_t * pCtx,
+                                        SdpLineInfo_t * pLines,
+                                        size_t maxLines,
+                                        size_t * pLineCount );
+
+/* Find every media section from the current position to the end of the
+ * message in a single pass without moving the context. If pSections is NULL,
+ * only the sections are counted. If more than maxSections sections are
+ * present, SDP_RESULT_OUT_OF_MEMORY is returned and *pSectionCount is the
+ * number of sections needed. To read section N, initialize a deserializer
+ * context with pStart + startOffset and endOffset - startOffset. */
+SdpResult_t SdpDeserializer_IndexMediaSections( const SdpDeserializerContext_t * pCtx,
+                                                SdpMediaSectionInfo_t * pSections,
+                                                size_t maxSections,
+                                                size_t * pSectionCount );
+
+/* Find every line that starts with one of the patterns, from the current
+ * position to the end of the message, in a single pass over the raw buffer
+ * without tokenizing it and without moving the context. A line that fits
+ * several patterns matches the longest of them, e.g. "a=ssrc-group:" rather
+ * than "a=ssrc", or the first of equal ones. If pMatches is NULL, only the
+ * matches are counted. If more than maxMatches lines match, SDP_RESULT_OUT_OF_MEMORY is
+ * returned and *pMatchCount is the number of matches needed. */
+SdpResult_t SdpDeserializer_ScanPrefixes( const SdpDeserializerContext_t * pCtx,
+                                          const SdpScanPattern_t * pPatterns,
+                                          size_t patternCount,
+                                          SdpScanMatch_t * pMatches,
+                                          size_t maxMatches,
+                                          size_t * pMatchCount );
+
 SdpResult_t SdpDeserializer_ParseOriginator( const char * pValue,
                                              size_t valueLength,
                                              SdpOriginator_t * pOriginator );
@@ -41,9 +307,117 @@ SdpResult_t SdpDeserializer_ParseAttribute( const char * pValue,
                                             size_t valueLength,
                                             SdpAttribute_t * pAttribute );
 
+/* Classify an attribute name in O(1). Names outside the registry, and a NULL
+ * name, are SDP_ATTRIBUTE_KIND_UNKNOWN. */
+SdpAttributeKind_t SdpDeserializer_GetAttributeKind( const char * pAttributeName,
+                                                     size_t attributeNameLength );
+
+/* Same as SdpDeserializer_ParseAttribute, and also classify the name. */
+SdpResult_t SdpDeserializer_ParseAttributeWithKind( const char * pValue,
+                                                    size_t valueLength,
+                                                    SdpAttribute_t * pAttribute,
+                                                    SdpAttributeKind_t * pKind );
+
 SdpResult_t SdpDeserializer_ParseMedia( const char * pValue,
                                         size_t valueLength,
                                         SdpMedia_t * pMedia );
+
+/* Parse the value of an "a=candidate" attribute, with or without the
+ * "candidate:" prefix. Strings point into pValue. Extensions other than
+ * "raddr", "rport" and "tcptype" are stored in order; SDP_RESULT_OUT_OF_MEMORY
+ * is returned if there are more than SDP_ICE_CANDIDATE_MAX_EXTENSIONS. */
+SdpResult_t SdpDeserializer_ParseIceCandidate( const char * pValue,
+                                               size_t valueLength,
+                                               SdpIceCandidate_t * pCandidate );
+
+/* Parse an "a=rtpmap" attribute returned by SdpDeserializer_ParseAttribute.
+ * The encoding name points into the attribute value. */
+SdpResult_t SdpDeserializer_ParseRtpMap( const SdpAttribute_t * pAttribute,
+                                         SdpRtpMap_t * pRtpMap );
+
+/* Parse an "a=fmtp" attribute returned by SdpDeserializer_ParseAttribute. The
+ * parameters point into the attribute value and are read with
+ * SdpDeserializer_GetNextFmtpParameter. */
+SdpResult_t SdpDeserializer_ParseFmtp( const SdpAttribute_t * pAttribute,
+                                       SdpFmtp_t * pFmtp );
+
+/* Get the next "<key>[=<value>]" parameter of an fmtp attribute. *pOffset
+ * must be 0 for the first call. Spaces around keys and values, and empty
+ * parameters, are skipped. SDP_RESULT_MESSAGE_END is returned when there are
+ * no more parameters. */
+SdpResult_t SdpDeserializer_GetNextFmtpParameter( const SdpFmtp_t * pFmtp,
+                                                  size_t * pOffset,
+                                                  SdpFmtpParameter_t * pParameter );
+
+/* Parse an "a=fingerprint" attribute returned by SdpDeserializer_ParseAttribute
+ * and decode the digest. The hash name is matched without regard to case and
+ * the digest of a known hash function must have the length of that hash. */
+SdpResult_t SdpDeserializer_ParseFingerprint( const SdpAttribute_t * pAttribute,
+                                              SdpFingerprint_t * pFingerprint );
+
+/* Compare a parsed fingerprint with a certificate digest in constant time.
+ * SDP_RESULT_FINGERPRINT_MISMATCH is returned if they differ. */
+SdpResult_t SdpDeserializer_CompareFingerprint( const SdpFingerprint_t * pFingerprint,
+                                                const uint8_t * pDigest,
+                                                size_t digestLength );
+
+/* Parse an "a=rtcp-fb" attribute. The parameter is the rest of the value after
+ * the type, e.g. "pli" for "96 nack pli". */
+SdpResult_t SdpDeserializer_ParseRtcpFeedback( const SdpAttribute_t * pAttribute,
+                                               SdpRtcpFeedback_t * pRtcpFeedback );
+
+/* Parse an "a=extmap" attribute. */
+SdpResult_t SdpDeserializer_ParseExtMap( const SdpAttribute_t * pAttribute,
+                                         SdpExtMap_t * pExtMap );
+
+/* Parse an "a=ssrc" attribute. The value may contain spaces, e.g. the stream
+ * and track IDs of "msid". */
+SdpResult_t SdpDeserializer_ParseSsrc( const SdpAttribute_t * pAttribute,
+                                       SdpSsrc_t * pSsrc );
+
+/* Parse an "a=ssrc-group" attribute. SDP_RESULT_OUT_OF_MEMORY is returned if
+ * there are more than SDP_SSRC_GROUP_MAX_SSRCS SSRCs. */
+SdpResult_t SdpDeserializer_ParseSsrcGroup( const SdpAttribute_t * pAttribute,
+                                            SdpSsrcGroup_t * pSsrcGroup );
+
+/* Parse the rest of the message into a session description. "u=", "e=",
+ * "p=", "r=", "z=" and "k=" lines are skipped. */
+SdpResult_t SdpDeserializer_ParseSession( SdpDeserializerContext_t * pCtx,
+                                          const SdpSessionStorage_t * pStorage,
+                                          SdpSessionDescription_t * pSession );
+
+/* Same as SdpDeserializer_ParseSession, but the arrays are sized exactly for
+ * the message and carved from pArena. */
+SdpResult_t SdpDeserializer_ParseSessionWithArena( SdpDeserializerContext_t * pCtx,
+                                                   SdpArena_t * pArena,
+                                                   SdpSessionDescription_t * pSession );
+
+/* Parse the rest of the message line by line and call the callbacks of
+ * pVisitor with the parsed lines. */
+SdpResult_t SdpDeserializer_Walk( SdpDeserializerContext_t * pCtx,
+                                  const SdpVisitor_t * pVisitor,
+                                  void * pUserContext );
+
+/* Same as SdpDeserializer_Walk, but lines not selected by pMask are skipped
+ * without being parsed, and the walk stops with SDP_RESULT_OK as soon as
+ * every selected line type and attribute kind has been visited once. The
+ * context is left after the last visited line. */
+SdpResult_t SdpDeserializer_WalkSelected( SdpDeserializerContext_t * pCtx,
+                                          const SdpVisitor_t * pVisitor,
+                                          void * pUserContext,
+                                          const SdpParseMask_t * pMask );
+
+/* Parse the slots of a batch that belong to worker workerIndex of
+ * workerCount, i.e. slots workerIndex, workerIndex + workerCount, and so on,
+ * with SdpDeserializer_ParseSessionWithArena. Workers share no state as long
+ * as no two slots share an arena or the static region of SdpArena_Init, so
+ * each thread of a pool can call this with its own index and no locking;
+ * a single thread passes 0 and 1. A failed message does not stop the batch,
+ * its error is stored in the result of its slot. */
+SdpResult_t SdpDeserializer_ParseBatch( SdpBatchSlot_t * pSlots,
+                                        size_t slotCount,
+                                        size_t workerIndex,
+                                        size_t workerCount );
 /*-----------------------------------------------------------*/
 
 #endif /* SDP_DESERIALIZER_H */
@@ -3,11 +3,60 @@
 
 #include "sdp_data_types.h"
 
+/* Called when a line does not fit in the output buffer. Behaves like
+ * realloc: return a buffer of newLength bytes that starts with the contents
+ * of pBuffer, which may be NULL, or NULL to fail and keep pBuffer. */
+typedef char * ( * SdpSerializerGrowCallback_t )( void * pGrowContext,
+                                                  char * pBuffer,
+                                                  size_t newLength );
+
+/* One piece of a message serialized with SdpSerializer_InitGather. Copy the
+ * fields into a struct iovec to pass the message to writev() or sendmsg(). */
+typedef struct SdpIoVector
+{
+    const char * pBase;
+    size_t length;
+} SdpIoVector_t;
+
+/* Index of the placeholder after the last static span of a template. */
+#define SDP_TEMPLATE_NO_PLACEHOLDER    ( SIZE_MAX )
+
+/* A static span of the skeleton of a template, followed by a placeholder. */
+typedef struct SdpTemplatePart
+{
+    size_t offset;
+    size_t length;
+    size_t placeholderIndex;
+} SdpTemplatePart_t;
+
+typedef struct SdpTemplate
+{
+    const char * pSkeleton;
+    const SdpTemplatePart_t * pParts;
+    size_t partCount;
+    size_t placeholderCount;
+} SdpTemplate_t;
+
+/* Value of a placeholder. When pValue is NULL, number is written in decimal
+ * instead. */
+typedef struct SdpTemplateValue
+{
+    const char * pValue;
+    size_t valueLength;
+    uint64_t number;
+} SdpTemplateValue_t;
+
 typedef struct SdpSerializerContext
 {
     char * pStart;
     size_t totalLength;
     size_t currentIndex;
+    SdpSerializerGrowCallback_t growCallback;
+    void * pGrowContext;
+    SdpIoVector_t * pIoVectors;
+    size_t maxIoVectors;
+    size_t ioVectorCount;
+    size_t gatheredLength;
 } SdpSerializerContext_t;
 
 /*-----------------------------------------------------------*/
@@ -16,6 +65,28 @@ SdpResult_t SdpSerializer_Init( SdpSerializerContext_t * pCtx,
                                 char * pBuffer,
                                 size_t bufferLength );
 
+/* Same as SdpSerializer_Init, but the buffer is grown with growCallback,
+ * at least doubling its size, instead of returning SDP_RESULT_OUT_OF_MEMORY.
+ * pBuffer may be NULL. The buffer can move on every Add* call, so use the
+ * one returned by SdpSerializer_Finalize. */
+SdpResult_t SdpSerializer_InitGrowable( SdpSerializerContext_t * pCtx,
+                                        char * pBuffer,
+                                        size_t bufferLength,
+                                        SdpSerializerGrowCallback_t growCallback,
+                                        void * pGrowContext );
+
+/* Serialize into a list of pieces instead of one flat buffer. Strings of the
+ * caller, such as attribute values, are referenced and not copied, so they
+ * must stay valid until the message is sent. The "<type>=" prefixes,
+ * numbers, separators and "\r\n" are copied into pScratch, and adjacent
+ * copies share one piece. A line that does not fit in pScratch or
+ * pIoVectors returns SDP_RESULT_OUT_OF_MEMORY and is not added. */
+SdpResult_t SdpSerializer_InitGather( SdpSerializerContext_t * pCtx,
+                                      char * pScratch,
+                                      size_t scratchLength,
+                                      SdpIoVector_t * pIoVectors,
+                                      size_t maxIoVectors );
+
 SdpResult_t SdpSerializer_AddBuffer( SdpSerializerContext_t * pCtx,
                                      uint8_t type,
                                      const char * pValue,
@@ -57,6 +128,96 @@ SdpResult_t SdpSerializer_Finalize( SdpSerializerContext_t * pCtx,
                                     const char ** pSdpMessage,
                                     size_t * pSdpMessageLength );
 
+/* Get the number of pieces written to the pIoVectors of
+ * SdpSerializer_InitGather, and the total length of the message. */
+SdpResult_t SdpSerializer_FinalizeGather( SdpSerializerContext_t * pCtx,
+                                          size_t * pIoVectorCount,
+                                          size_t * pSdpMessageLength );
+
+/* Append a whole session description: "v=", "o=", "s=", "i=", "c=", "b=",
+ * "t=" and "a=" lines, then for each media description its "m=", "i=", "c=",
+ * "b=" and "a=" lines. "s=" and "i=" are skipped when they are empty. */
+SdpResult_t SdpSerializer_AddSession( SdpSerializerContext_t * pCtx,
+                                      const SdpSessionDescription_t * pSession );
+
+/* Length of the line that the matching SdpSerializer_Add* function appends,
+ * including "<type>=" and "\r\n", computed from digit counts and string
+ * lengths without formatting anything. */
+size_t SdpSerializer_GetBufferLineLength( const char * pValue,
+                                          size_t valueLength );
+
+size_t SdpSerializer_GetU32LineLength( uint32_t value );
+
+size_t SdpSerializer_GetU64LineLength( uint64_t value );
+
+size_t SdpSerializer_GetOriginatorLineLength( const SdpOriginator_t * pOriginator );
+
+size_t SdpSerializer_GetConnectionInfoLineLength( const SdpConnectionInfo_t * pConnInfo );
+
+size_t SdpSerializer_GetBandwidthInfoLineLength( const SdpBandwidthInfo_t * pBandwidthInfo );
+
+size_t SdpSerializer_GetTimeActiveLineLength( const SdpTimeDescription_t * pTimeDescription );
+
+size_t SdpSerializer_GetAttributeLineLength( const SdpAttribute_t * pAttribute );
+
+size_t SdpSerializer_GetMediaLineLength( const SdpMedia_t * pMedia );
+
+/* Exact size of the buffer that SdpSerializer_AddSession needs for
+ * pSession, including the NULL terminator, or 0 if pSession is NULL. */
+size_t SdpSerializer_GetSessionBufferLength( const SdpSessionDescription_t * pSession );
+
+/* Split a serialized skeleton into static spans and placeholders. A
+ * placeholder is written in the skeleton as "{<name>}", for example with
+ * SdpSerializer_AddAttribute( ..., { "ice-ufrag", 9, "{ice-ufrag}", 11 } ),
+ * and ppPlaceholderNames lists the names without braces. Numbers such as the
+ * session version or a port are marked by adding their line with
+ * SdpSerializer_AddBuffer. Other text in braces stays static.
+ *
+ * The template references the skeleton and pParts, which must outlive it.
+ * With a NULL pParts only pPartCount is computed. If pParts is too small,
+ * SDP_RESULT_OUT_OF_MEMORY is returned with the count needed. */
+SdpResult_t SdpSerializer_CompileTemplate( SdpTemplate_t * pTemplate,
+                                           const char * pSkeleton,
+                                           size_t skeletonLength,
+                                           const char * const * ppPlaceholderNames,
+                                           size_t placeholderCount,
+                                           SdpTemplatePart_t * pParts,
+                                           size_t maxParts,
+                                           size_t * pPartCount );
+
+/* Write a template with pValues[ i ] in place of placeholder i, followed by a
+ * NULL terminator. pMessageLength always receives the message length; with
+ * a NULL pBuffer nothing is written, and a buffer that is too small returns
+ * SDP_RESULT_OUT_OF_MEMORY. */
+SdpResult_t SdpSerializer_RenderTemplate( const SdpTemplate_t * pTemplate,
+                                          const SdpTemplateValue_t * pValues,
+                                          size_t valueCount,
+                                          char * pBuffer,
+                                          size_t bufferLength,
+                                          size_t * pMessageLength );
+
+/* Rewrite the session version in the "o=" line of a serialized message in
+ * place. The version is padded with leading zeros to the width of the
+ * current field and to at least minimumDigits digits, so the rest of the
+ * message is moved only when the field grows. Setting it once with 20
+ * digits, the most a uint64_t needs, reserves room for every later version.
+ * pMessageLength is updated, and the message stays NULL terminated within
+ * bufferLength bytes. */
+SdpResult_t SdpSerializer_SetSessionVersion( char * pBuffer,
+                                             size_t bufferLength,
+                                             size_t * pMessageLength,
+                                             uint64_t sessionVersion,
+                                             size_t minimumDigits );
+
+/* Same as SdpSerializer_SetSessionVersion with the current version plus one,
+ * which is returned in pSessionVersion if it is not NULL. A version that
+ * cannot be incremented returns SDP_RESULT_BAD_PARAM. */
+SdpResult_t SdpSerializer_IncrementSessionVersion( char * pBuffer,
+                                                   size_t bufferLength,
+                                                   size_t * pMessageLength,
+                                                   size_t minimumDigits,
+                                                   uint64_t * pSessionVersion );
+
 /* Currently repeat times ("r="), time zone adjustment ("z=") and, encryption
  * keys ("k=") are not supported. */
 
@@ -0,0 +1,72 @@
+#ifndef SDP_SESSION_VIEW_H
+#define SDP_SESSION_VIEW_H
+
+#include "sdp_deserializer.h"
+
+/* Pass as mediaIndex to read the session-level lines. */
+#define SDP_SESSION_VIEW_SESSION_LEVEL    ( SIZE_MAX )
+
+/* Lines of the session level or of one media section. The parsed fields are
+ * filled on first access. */
+typedef struct SdpSessionViewSection
+{
+    size_t firstLine;
+    size_t lineCount;
+    uint8_t parsedFlags;
+    SdpMedia_t media;
+    SdpAttribute_t * pAttributes;
+    SdpAttributeKind_t * pAttributeKinds;
+    size_t attributeCount;
+} SdpSessionViewSection_t;
+
+/* A session description that is parsed on demand. pSections[ 0 ] is the
+ * session level and pSections[ i + 1 ] is media section i. */
+typedef struct SdpSessionView
+{
+    const char * pStart;
+    SdpArena_t * pArena;
+    SdpLineInfo_t * pLines;
+    size_t lineCount;
+    SdpSessionViewSection_t * pSections;
+    size_t mediaCount;
+    uint8_t parsedFlags;
+    SdpOriginator_t originator;
+} SdpSessionView_t;
+
+/*-----------------------------------------------------------*/
+
+/* Index the lines of the rest of the message without parsing them. The line
+ * index is carved from pArena, and so are the caches filled later, so the
+ * arena and the message must outlive the view. */
+SdpResult_t SdpSessionView_Init( SdpSessionView_t * pView,
+                                 const SdpDeserializerContext_t * pCtx,
+                                 SdpArena_t * pArena );
+
+/* Parse the "o=" line on first call. */
+SdpResult_t SdpSessionView_GetOriginator( SdpSessionView_t * pView,
+                                          const SdpOriginator_t ** ppOriginator );
+
+SdpResult_t SdpSessionView_GetMediaCount( const SdpSessionView_t * pView,
+                                          size_t * pMediaCount );
+
+/* Parse the "m=" line of a media section on first call. */
+SdpResult_t SdpSessionView_GetMedia( SdpSessionView_t * pView,
+                                     size_t mediaIndex,
+                                     const SdpMedia_t ** ppMedia );
+
+/* Copy the attributes of one kind in a media section, or at the session level
+ * with SDP_SESSION_VIEW_SESSION_LEVEL. All "a=" lines of the section are
+ * parsed on the first call for that section. If pAttributes is NULL, only the
+ * attributes are counted. If there are more than maxAttributes,
+ * SDP_RESULT_OUT_OF_MEMORY is returned and *pAttributeCount is the number
+ * needed. */
+SdpResult_t SdpSessionView_GetAttributes( SdpSessionView_t * pView,
+                                          size_t mediaIndex,
+                                          SdpAttributeKind_t kind,
+                                          SdpAttribute_t * pAttributes,
+                                          size_t maxAttributes,
+                                          size_t * pAttributeCount );
+
+/*-----------------------------------------------------------*/
+
+#endif /* SDP_SESSION_VIEW_H */
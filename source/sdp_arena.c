@@ -0,0 +1,165 @@
+/* Standard includes. */
+#include <string.h>
+
+/* Interface includes. */
+#include "sdp_arena.h"
+
+#if ( SDP_ARENA_STATIC_BUFFER_SIZE > 0 )
+
+/**
+ * @brief Static region used by arenas initialized without a buffer.
+ *
+ * Declared as uint64_t so that it is aligned for any SDP structure.
+ */
+    static uint64_t arenaStaticBuffer[ ( SDP_ARENA_STATIC_BUFFER_SIZE + sizeof( uint64_t ) - 1U ) / sizeof( uint64_t ) ];
+#endif
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Number of bytes needed to align the next allocation in the current
+ * block.
+ *
+ * @param[in] pArena The arena.
+ *
+ * @return The padding, in bytes.
+ */
+static size_t AlignmentPadding( const SdpArena_t * pArena );
+
+/*-----------------------------------------------------------*/
+
+static size_t AlignmentPadding( const SdpArena_t * pArena )
+{
+    size_t misalignment;
+
+    misalignment = ( size_t ) ( ( ( uintptr_t ) pArena->pBuffer + pArena->used ) % SDP_ARENA_ALIGNMENT );
+
+    return ( misalignment == 0U ) ? 0U : ( SDP_ARENA_ALIGNMENT - misalignment );
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpArena_Init( SdpArena_t * pArena,
+                           void * pBuffer,
+                           size_t bufferLength,
+                           SdpArenaGrowCallback_t growCallback,
+                           void * pGrowContext )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pArena == NULL ) ||
+        ( ( pBuffer == NULL ) && ( bufferLength != 0U ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        #if ( SDP_ARENA_STATIC_BUFFER_SIZE > 0 )
+            if( pBuffer == NULL )
+            {
+                pBuffer = &( arenaStaticBuffer[ 0 ] );
+                bufferLength = SDP_ARENA_STATIC_BUFFER_SIZE;
+            }
+        #endif
+
+        pArena->pInitialBuffer = ( uint8_t * ) pBuffer;
+        pArena->initialBufferLength = bufferLength;
+        pArena->pBuffer = ( uint8_t * ) pBuffer;
+        pArena->bufferLength = bufferLength;
+        pArena->used = 0;
+        pArena->growCallback = growCallback;
+        pArena->pGrowContext = pGrowContext;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpArena_Allocate( SdpArena_t * pArena,
+                               size_t size,
+                               void ** ppMemory )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t padding = 0;
+    size_t blockLength;
+    uint8_t * pBlock;
+
+    if( ( pArena == NULL ) ||
+        ( size == 0U ) ||
+        ( ppMemory == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        padding = AlignmentPadding( pArena );
+
+        if( ( pArena->bufferLength - pArena->used < padding ) ||
+            ( pArena->bufferLength - pArena->used - padding < size ) )
+        {
+            /* Each new block is twice as large as the previous one, or just
+             * large enough for the request, so the capacity grows
+             * geometrically. The extra SDP_ARENA_ALIGNMENT - 1 bytes cover
+             * the padding of an unaligned block. */
+            if( ( pArena->growCallback == NULL ) ||
+                ( pArena->bufferLength > ( SIZE_MAX / 2U ) ) ||
+                ( size > ( SIZE_MAX - ( SDP_ARENA_ALIGNMENT - 1U ) ) ) )
+            {
+                result = SDP_RESULT_OUT_OF_MEMORY;
+            }
+            else
+            {
+                blockLength = size + SDP_ARENA_ALIGNMENT - 1U;
+
+                if( ( pArena->bufferLength * 2U ) > blockLength )
+                {
+                    blockLength = pArena->bufferLength * 2U;
+                }
+
+                pBlock = ( uint8_t * ) pArena->growCallback( pArena->pGrowContext, blockLength );
+
+                if( pBlock == NULL )
+                {
+                    result = SDP_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    pArena->pBuffer = pBlock;
+                    pArena->bufferLength = blockLength;
+                    pArena->used = 0;
+                    padding = AlignmentPadding( pArena );
+                }
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *ppMemory = &( pArena->pBuffer[ pArena->used + padding ] );
+        pArena->used += padding + size;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpArena_Reset( SdpArena_t * pArena )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( pArena == NULL )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pArena->pBuffer = pArena->pInitialBuffer;
+        pArena->bufferLength = pArena->initialBufferLength;
+        pArena->used = 0;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
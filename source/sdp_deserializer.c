@@ -1,532 +1,3654 @@
 /* Standard includes. */
-#include <stdio.h>
 #include <string.h>
 
 /* Interface includes. */
 #include "sdp_deserializer.h"
 
+/* SIMD includes. */
+#if ( SDP_USE_SIMD != 0 ) && defined( __GNUC__ )
+    #if defined( __SSE2__ )
+        #include <immintrin.h>
+        #define SDP_SIMD_SSE2
+        #if defined( __AVX2__ )
+            #define SDP_SIMD_AVX2
+        #endif
+    #elif defined( __ARM_NEON ) && defined( __aarch64__ )
+        #include <arm_neon.h>
+        #define SDP_SIMD_NEON
+    #endif
+#endif
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Shortest and longest attribute names in the registry.
+ */
+#define SDP_ATTRIBUTE_NAME_MIN_LENGTH    ( 3 )
+#define SDP_ATTRIBUTE_NAME_MAX_LENGTH    ( 18 )
+
+/**
+ * @brief Largest RTP payload type.
+ */
+#define SDP_RTP_PAYLOAD_TYPE_MAX    ( 127 )
+
+/**
+ * @brief Number of digest bytes decoded by DecodeHexBlock.
+ */
+#define SDP_HEX_BLOCK_BYTES         ( 16 )
+
+/**
+ * @brief Returned by HexValue for a character that is not a hex digit.
+ */
+#define SDP_HEX_INVALID             ( 0xFFU )
+
+/**
+ * @brief Perfect hash of an attribute name of at least
+ * SDP_ATTRIBUTE_NAME_MIN_LENGTH characters.
+ *
+ * It mixes the length with the first, second, middle and last characters,
+ * which tell the registered names apart. The multipliers are one set for
+ * which every name in attributeNames gets its own slot of
+ * attributeKindTable. tools/sdp_attribute_hash.py checks a set of
+ * multipliers or searches for a new one, and prints this macro and the
+ * table. Run it again when a name is added.
+ */
+#define SDP_ATTRIBUTE_NAME_HASH( pName, length )                          \
+    ( ( ( ( length ) * 20U ) +                                            \
+        ( ( size_t ) ( uint8_t ) ( pName )[ 0 ] * 26U ) +                 \
+        ( ( size_t ) ( uint8_t ) ( pName )[ 1 ] * 9U ) +                  \
+        ( ( size_t ) ( uint8_t ) ( pName )[ ( length ) / 2U ] * 17U ) +   \
+        ( ( size_t ) ( uint8_t ) ( pName )[ ( length ) - 1U ] * 8U ) ) & 127U )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief An attribute name and its length.
+ */
+typedef struct SdpAttributeName
+{
+    const char * pName;
+    size_t nameLength;
+} SdpAttributeName_t;
+
+/**
+ * @brief A fingerprint hash function, its name and its digest length.
+ */
+typedef struct SdpFingerprintHashInfo
+{
+    SdpFingerprintHash_t hashFunction;
+    const char * pName;
+    size_t nameLength;
+    size_t digestLength;
+} SdpFingerprintHashInfo_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attribute names indexed by SdpAttributeKind_t.
+ */
+static const SdpAttributeName_t attributeNames[ SDP_ATTRIBUTE_KIND_COUNT ] =
+{
+    { NULL, 0 },
+    { "cat", 3 },
+    { "keywds", 6 },
+    { "tool", 4 },
+    { "ptime", 5 },
+    { "maxptime", 8 },
+    { "rtpmap", 6 },
+    { "recvonly", 8 },
+    { "sendrecv", 8 },
+    { "sendonly", 8 },
+    { "inactive", 8 },
+    { "orient", 6 },
+    { "type", 4 },
+    { "charset", 7 },
+    { "sdplang", 7 },
+    { "lang", 4 },
+    { "framerate", 9 },
+    { "quality", 7 },
+    { "fmtp", 4 },
+    { "ice-ufrag", 9 },
+    { "ice-pwd", 7 },
+    { "ice-options", 11 },
+    { "ice-lite", 8 },
+    { "ice-mismatch", 12 },
+    { "ice-pacing", 10 },
+    { "candidate", 9 },
+    { "remote-candidates", 17 },
+    { "end-of-candidates", 17 },
+    { "fingerprint", 11 },
+    { "setup", 5 },
+    { "connection", 10 },
+    { "mid", 3 },
+    { "group", 5 },
+    { "msid", 4 },
+    { "msid-semantic", 13 },
+    { "ssrc", 4 },
+    { "ssrc-group", 10 },
+    { "rtcp", 4 },
+    { "rtcp-mux", 8 },
+    { "rtcp-mux-only", 13 },
+    { "rtcp-rsize", 10 },
+    { "rtcp-fb", 7 },
+    { "extmap", 6 },
+    { "extmap-allow-mixed", 18 },
+    { "rid", 3 },
+    { "simulcast", 9 },
+    { "sctp-port", 9 },
+    { "max-message-size", 16 },
+    { "sctpmap", 7 },
+    { "crypto", 6 },
+    { "identity", 8 },
+    { "bundle-only", 11 },
+    { "label", 5 },
+    { "content", 7 },
+    { "tls-id", 6 }
+};
+
+/**
+ * @brief Attribute kinds indexed by SDP_ATTRIBUTE_NAME_HASH. Every registered
+ * name hashes to a different slot, so one comparison confirms a match.
+ * Generated by tools/sdp_attribute_hash.py.
+ */
+static const uint8_t attributeKindTable[ 128 ] =
+{
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SENDONLY, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_INACTIVE, SDP_ATTRIBUTE_KIND_RTCP_MUX, SDP_ATTRIBUTE_KIND_MSID, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_ICE_OPTIONS, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_RTCP,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_ORIENT, SDP_ATTRIBUTE_KIND_ICE_PACING, SDP_ATTRIBUTE_KIND_QUALITY,
+    SDP_ATTRIBUTE_KIND_MID, SDP_ATTRIBUTE_KIND_ICE_LITE, SDP_ATTRIBUTE_KIND_RID, SDP_ATTRIBUTE_KIND_FINGERPRINT,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SENDRECV, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SDPLANG, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SCTPMAP, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_LABEL,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_TLS_ID, SDP_ATTRIBUTE_KIND_RTCP_RSIZE, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_EXTMAP_ALLOW_MIXED, SDP_ATTRIBUTE_KIND_EXTMAP,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SSRC,
+    SDP_ATTRIBUTE_KIND_RTCP_FB, SDP_ATTRIBUTE_KIND_FMTP, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_LANG,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_RTCP_MUX_ONLY, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_GROUP,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_TOOL, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_CONNECTION, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_CAT, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_IDENTITY, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_CANDIDATE, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_ICE_PWD, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SETUP,
+    SDP_ATTRIBUTE_KIND_MAX_MESSAGE_SIZE, SDP_ATTRIBUTE_KIND_CONTENT, SDP_ATTRIBUTE_KIND_ICE_UFRAG, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_SSRC_GROUP, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_RTPMAP, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_SIMULCAST,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_KEYWDS, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_RECVONLY, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_BUNDLE_ONLY, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_MSID_SEMANTIC, SDP_ATTRIBUTE_KIND_FRAMERATE,
+    SDP_ATTRIBUTE_KIND_CRYPTO, SDP_ATTRIBUTE_KIND_TYPE, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_CHARSET, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_MAXPTIME,
+    SDP_ATTRIBUTE_KIND_ICE_MISMATCH, SDP_ATTRIBUTE_KIND_PTIME, SDP_ATTRIBUTE_KIND_SCTP_PORT, SDP_ATTRIBUTE_KIND_UNKNOWN,
+    SDP_ATTRIBUTE_KIND_UNKNOWN, SDP_ATTRIBUTE_KIND_END_OF_CANDIDATES, SDP_ATTRIBUTE_KIND_REMOTE_CANDIDATES, SDP_ATTRIBUTE_KIND_UNKNOWN
+};
+
+/**
+ * @brief Hash functions recognized by SdpDeserializer_ParseFingerprint.
+ */
+static const SdpFingerprintHashInfo_t fingerprintHashes[] =
+{
+    { SDP_FINGERPRINT_HASH_SHA_1, "sha-1", 5, 20 },
+    { SDP_FINGERPRINT_HASH_SHA_224, "sha-224", 7, 28 },
+    { SDP_FINGERPRINT_HASH_SHA_256, "sha-256", 7, 32 },
+    { SDP_FINGERPRINT_HASH_SHA_384, "sha-384", 7, 48 },
+    { SDP_FINGERPRINT_HASH_SHA_512, "sha-512", 7, 64 },
+    { SDP_FINGERPRINT_HASH_MD5, "md5", 3, 16 },
+    { SDP_FINGERPRINT_HASH_MD2, "md2", 3, 16 }
+};
+
+/**
+ * @brief Lanes of a 48 character hex block that hold the ':' separators.
+ */
+static const uint8_t hexBlockColonLanes[ 3U * SDP_HEX_BLOCK_BYTES ] =
+{
+    0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0,
+    0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0,
+    0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF
+};
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Find the first '\n' in the buffer.
+ *
+ * @param[in] pBuffer The buffer to search.
+ * @param[in] length Length of the buffer.
+ *
+ * @return The offset of the first '\n' or length if there is none.
+ */
+static size_t FindNewline( const char * pBuffer,
+                           size_t length );
+
+/**
+ * @brief Count the trailing zero bits of a non-zero value.
+ *
+ * @param[in] value The value.
+ *
+ * @return Index of the lowest set bit.
+ */
+static size_t CountTrailingZeros( uint64_t value );
+
+/**
+ * @brief Build a bit mask of the '\n' characters in 64 bytes.
+ *
+ * @param[in] pBuffer The buffer to search. It must have at least 64 bytes.
+ *
+ * @return A mask in which bit N is set if pBuffer[ N ] is '\n'.
+ */
+static uint64_t NewlineMask64( const char * pBuffer );
+
+/**
+ * @brief Parse an unsigned decimal integer that spans the whole buffer.
+ *
+ * The buffer does not need to be NULL terminated. Eight digits are converted
+ * per step when enough input is available.
+ *
+ * @param[in] pBuffer The digits to parse.
+ * @param[in] length Number of digits in the buffer.
+ * @param[in] maxValue The largest value accepted.
+ * @param[out] pValue The parsed value.
+ *
+ * @return SDP_RESULT_OK if the buffer is a non-empty string of digits whose
+ * value does not exceed maxValue, SDP_RESULT_MESSAGE_MALFORMED otherwise.
+ */
+static SdpResult_t ParseUnsignedInteger( const char * pBuffer,
+                                         size_t length,
+                                         uint64_t maxValue,
+                                         uint64_t * pValue );
+
+/**
+ * @brief Get the next space separated token.
+ *
+ * @param[in] pValue The buffer to read from.
+ * @param[in] valueLength Length of the buffer.
+ * @param[in,out] pOffset Offset to start at. Updated to the end of the token.
+ * @param[out] ppToken The token.
+ * @param[out] pTokenLength Length of the token.
+ *
+ * @return SDP_RESULT_OK if a token was found, SDP_RESULT_MESSAGE_END if only
+ * spaces are left.
+ */
+static SdpResult_t NextToken( const char * pValue,
+                              size_t valueLength,
+                              size_t * pOffset,
+                              const char ** ppToken,
+                              size_t * pTokenLength );
+
+/**
+ * @brief Check whether a token is equal to a string literal.
+ *
+ * @param[in] pToken The token.
+ * @param[in] tokenLength Length of the token.
+ * @param[in] pLiteral The literal.
+ * @param[in] literalLength Length of the literal.
+ *
+ * @return 1 if they are equal, 0 otherwise.
+ */
+static int TokenEquals( const char * pToken,
+                        size_t tokenLength,
+                        const char * pLiteral,
+                        size_t literalLength );
+
+/**
+ * @brief Move start forward and end backward past spaces.
+ *
+ * @param[in] pBuffer The buffer.
+ * @param[in,out] pStart Offset of the first character.
+ * @param[in,out] pEnd Offset one past the last character.
+ */
+static void TrimSpaces( const char * pBuffer,
+                        size_t * pStart,
+                        size_t * pEnd );
+
+/**
+ * @brief Check that an attribute has the expected name and a value.
+ *
+ * @param[in] pAttribute The attribute.
+ * @param[in] pName Expected attribute name.
+ * @param[in] nameLength Length of the expected attribute name.
+ *
+ * @return SDP_RESULT_OK if it does, SDP_RESULT_BAD_PARAM if the attribute has
+ * another name, SDP_RESULT_MESSAGE_MALFORMED if it has no value.
+ */
+static SdpResult_t CheckAttribute( const SdpAttribute_t * pAttribute,
+                                   const char * pName,
+                                   size_t nameLength );
+
+/**
+ * @brief Parse the payload type that starts an rtpmap or fmtp value.
+ *
+ * @param[in] pAttribute The attribute.
+ * @param[in] pName Expected attribute name.
+ * @param[in] nameLength Length of the expected attribute name.
+ * @param[out] pOffset Offset just after the payload type.
+ * @param[out] pPayloadType The payload type.
+ *
+ * @return SDP_RESULT_OK on success, SDP_RESULT_BAD_PARAM if the attribute
+ * has another name, SDP_RESULT_MESSAGE_MALFORMED if the payload type is
+ * missing or invalid.
+ */
+static SdpResult_t ParsePayloadType( const SdpAttribute_t * pAttribute,
+                                     const char * pName,
+                                     size_t nameLength,
+                                     size_t * pOffset,
+                                     uint8_t * pPayloadType );
+
+/**
+ * @brief Get the value of a hex digit.
+ *
+ * @param[in] c The character.
+ *
+ * @return 0 to 15, or SDP_HEX_INVALID if c is not a hex digit.
+ */
+static uint8_t HexValue( char c );
+
+/**
+ * @brief Decode SDP_HEX_BLOCK_BYTES "XX:" groups.
+ *
+ * @param[in] pBuffer 48 characters. Every third character must be ':'.
+ * @param[out] pDigest The decoded bytes.
+ *
+ * @return 1 if the block is valid, 0 otherwise.
+ */
+static int DecodeHexBlock( const char * pBuffer,
+                           uint8_t * pDigest );
+
+/**
+ * @brief Run the typed parser of an attribute and call the visitor callback
+ * for its kind.
+ *
+ * @param[in] pVisitor The visitor.
+ * @param[in] pUserContext Context passed to the callback.
+ * @param[in] mediaIndex Index of the current media section.
+ * @param[in] pAttribute The attribute.
+ * @param[in] kind The kind of the attribute.
+ *
+ * @return The result of the parser or the callback.
+ */
+static SdpResult_t VisitAttribute( const SdpVisitor_t * pVisitor,
+                                   void * pUserContext,
+                                   size_t mediaIndex,
+                                   const SdpAttribute_t * pAttribute,
+                                   SdpAttributeKind_t kind );
+
+/**
+ * @brief Walk the message, optionally only the lines selected by a mask.
+ *
+ * @param[in,out] pCtx The deserializer context.
+ * @param[in] pVisitor The visitor.
+ * @param[in] pUserContext Context passed to the callbacks.
+ * @param[in] pMask The lines to visit, or NULL for every line.
+ *
+ * @return SDP_RESULT_OK, or the first error of a parser or a callback.
+ */
+static SdpResult_t WalkLines( SdpDeserializerContext_t * pCtx,
+                              const SdpVisitor_t * pVisitor,
+                              void * pUserContext,
+                              const SdpParseMask_t * pMask );
+
+/*-----------------------------------------------------------*/
+
+static size_t FindNewline( const char * pBuffer,
+                           size_t length )
+{
+    size_t i = 0;
+    uint64_t mask = 0;
+
+    #if defined( SDP_SIMD_AVX2 )
+        const __m256i newline32 = _mm256_set1_epi8( '\n' );
+    #endif
+    #if defined( SDP_SIMD_SSE2 )
+        const __m128i newline16 = _mm_set1_epi8( '\n' );
+    #elif defined( SDP_SIMD_NEON )
+        const uint8x16_t newline16 = vdupq_n_u8( ( uint8_t ) '\n' );
+        uint8x16_t matches;
+    #endif
+
+    #if defined( SDP_SIMD_AVX2 )
+        while( ( mask == 0U ) && ( ( length - i ) >= 32U ) )
+        {
+            mask = ( uint32_t ) _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ i ] ) ),
+                                                                         newline32 ) );
+
+            if( mask == 0U )
+            {
+                i += 32U;
+            }
+        }
+    #endif /* SDP_SIMD_AVX2 */
+
+    #if defined( SDP_SIMD_SSE2 )
+        while( ( mask == 0U ) && ( ( length - i ) >= 16U ) )
+        {
+            mask = ( uint32_t ) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ i ] ) ),
+                                                                   newline16 ) );
+
+            if( mask == 0U )
+            {
+                i += 16U;
+            }
+        }
+
+        if( mask != 0U )
+        {
+            /* One bit per byte. */
+            i += CountTrailingZeros( mask );
+        }
+    #elif defined( SDP_SIMD_NEON )
+        while( ( mask == 0U ) && ( ( length - i ) >= 16U ) )
+        {
+            matches = vceqq_u8( vld1q_u8( ( const uint8_t * ) &( pBuffer[ i ] ) ), newline16 );
+
+            /* Narrow each 8-bit lane result to a 4-bit nibble of a 64-bit mask. */
+            mask = vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( matches ), 4 ) ), 0 );
+
+            if( mask == 0U )
+            {
+                i += 16U;
+            }
+        }
+
+        if( mask != 0U )
+        {
+            /* Four bits per byte. */
+            i += CountTrailingZeros( mask ) >> 2;
+        }
+    #endif /* SDP_SIMD_SSE2 */
+
+    if( mask == 0U )
+    {
+        /* Scalar search of the bytes not covered by a full vector. */
+        for( ; i < length; i++ )
+        {
+            if( pBuffer[ i ] == '\n' )
+            {
+                break;
+            }
+        }
+    }
+
+    return i;
+}
+/*-----------------------------------------------------------*/
+
+static size_t CountTrailingZeros( uint64_t value )
+{
+    size_t count = 0;
+
+    #if defined( __GNUC__ )
+        count = ( size_t ) __builtin_ctzll( value );
+    #else
+        while( ( value & 1U ) == 0U )
+        {
+            value >>= 1;
+            count++;
+        }
+    #endif
+
+    return count;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t NewlineMask64( const char * pBuffer )
+{
+    uint64_t mask = 0;
+
+    #if defined( SDP_SIMD_AVX2 )
+        const __m256i newline32 = _mm256_set1_epi8( '\n' );
+        uint64_t low, high;
+
+        low = ( uint32_t ) _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ 0 ] ) ),
+                                                                    newline32 ) );
+        high = ( uint32_t ) _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ 32 ] ) ),
+                                                                     newline32 ) );
+        mask = low | ( high << 32 );
+    #elif defined( SDP_SIMD_SSE2 )
+        const __m128i newline16 = _mm_set1_epi8( '\n' );
+        size_t i;
+
+        for( i = 0; i < 4U; i++ )
+        {
+            mask |= ( ( uint64_t ) ( uint32_t ) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ 16U * i ] ) ),
+                                                                                   newline16 ) ) ) << ( 16U * i );
+        }
+    #elif defined( SDP_SIMD_NEON )
+        static const uint8_t bitWeights[ 16 ] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t newline16 = vdupq_n_u8( ( uint8_t ) '\n' );
+        const uint8x16_t weights = vld1q_u8( bitWeights );
+        uint8x16_t matches[ 4 ], sum;
+        size_t i;
+
+        for( i = 0; i < 4U; i++ )
+        {
+            matches[ i ] = vandq_u8( vceqq_u8( vld1q_u8( ( const uint8_t * ) &( pBuffer[ 16U * i ] ) ), newline16 ),
+                                     weights );
+        }
+
+        /* Add adjacent bytes until every group of 8 matches is one byte. */
+        sum = vpaddq_u8( vpaddq_u8( matches[ 0 ], matches[ 1 ] ),
+                         vpaddq_u8( matches[ 2 ], matches[ 3 ] ) );
+        sum = vpaddq_u8( sum, sum );
+        mask = vgetq_lane_u64( vreinterpretq_u64_u8( sum ), 0 );
+    #else
+        size_t i;
+
+        for( i = 0; i < 64U; i++ )
+        {
+            if( pBuffer[ i ] == '\n' )
+            {
+                mask |= ( ( uint64_t ) 1U ) << i;
+            }
+        }
+    #endif /* SDP_SIMD_AVX2 */
+
+    return mask;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t ParseUnsignedInteger( const char * pBuffer,
+                                         size_t length,
+                                         uint64_t maxValue,
+                                         uint64_t * pValue )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i = 0, j;
+    uint64_t value = 0, chunk, digit;
+
+    if( length == 0 )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED;
+    }
+
+    /* Convert eight digits at a time. The first character is placed in the
+     * least significant byte regardless of the host byte order. */
+    while( ( result == SDP_RESULT_OK ) && ( ( length - i ) >= 8U ) )
+    {
+        chunk = 0;
+
+        for( j = 0; j < 8U; j++ )
+        {
+            chunk |= ( ( uint64_t ) ( uint8_t ) pBuffer[ i + j ] ) << ( 8U * j );
+        }
+
+        /* Every byte must be in '0'..'9': the high nibble must be 3 and
+         * adding 6 to the low nibble must not carry into the high nibble. */
+        if( ( ( chunk & 0xF0F0F0F0F0F0F0F0ULL ) |
+              ( ( ( chunk + 0x0606060606060606ULL ) & 0xF0F0F0F0F0F0F0F0ULL ) >> 4 ) ) != 0x3333333333333333ULL )
+        {
+            /* Let the scalar loop find the offending character. */
+            break;
+        }
+
+        chunk -= 0x3030303030303030ULL;
+        chunk = ( ( chunk * 10U ) + ( chunk >> 8 ) ) & 0x00FF00FF00FF00FFULL;
+        chunk = ( ( chunk * 100U ) + ( chunk >> 16 ) ) & 0x0000FFFF0000FFFFULL;
+        chunk = ( ( chunk * 10000U ) + ( chunk >> 32 ) ) & 0x00000000FFFFFFFFULL;
+
+        if( value > ( ( UINT64_MAX - chunk ) / 100000000U ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            value = ( value * 100000000U ) + chunk;
+            i += 8U;
+        }
+    }
+
+    for( ; ( result == SDP_RESULT_OK ) && ( i < length ); i++ )
+    {
+        if( ( pBuffer[ i ] < '0' ) || ( pBuffer[ i ] > '9' ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            digit = ( uint64_t ) ( pBuffer[ i ] - '0' );
+
+            if( value > ( ( UINT64_MAX - digit ) / 10U ) )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED;
+            }
+            else
+            {
+                value = ( value * 10U ) + digit;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( value > maxValue )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            *pValue = value;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t NextToken( const char * pValue,
+                              size_t valueLength,
+                              size_t * pOffset,
+                              const char ** ppToken,
+                              size_t * pTokenLength )
+{
+    SdpResult_t result = SDP_RESULT_MESSAGE_END;
+    size_t start = *pOffset, end;
+
+    while( ( start < valueLength ) && ( pValue[ start ] == ' ' ) )
+    {
+        start++;
+    }
+
+    if( start < valueLength )
+    {
+        end = start;
+
+        while( ( end < valueLength ) && ( pValue[ end ] != ' ' ) )
+        {
+            end++;
+        }
+
+        *ppToken = &( pValue[ start ] );
+        *pTokenLength = end - start;
+        *pOffset = end;
+        result = SDP_RESULT_OK;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static int TokenEquals( const char * pToken,
+                        size_t tokenLength,
+                        const char * pLiteral,
+                        size_t literalLength )
+{
+    return ( ( tokenLength == literalLength ) &&
+             ( memcmp( pToken, pLiteral, literalLength ) == 0 ) ) ? 1 : 0;
+}
+/*-----------------------------------------------------------*/
+
+static void TrimSpaces( const char * pBuffer,
+                        size_t * pStart,
+                        size_t * pEnd )
+{
+    while( ( *pStart < *pEnd ) && ( pBuffer[ *pStart ] == ' ' ) )
+    {
+        ( *pStart )++;
+    }
+
+    while( ( *pEnd > *pStart ) && ( pBuffer[ *pEnd - 1U ] == ' ' ) )
+    {
+        ( *pEnd )--;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t CheckAttribute( const SdpAttribute_t * pAttribute,
+                                   const char * pName,
+                                   size_t nameLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pAttribute->pAttributeName == NULL ) ||
+        ( TokenEquals( pAttribute->pAttributeName, pAttribute->attributeNameLength, pName, nameLength ) == 0 ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else if( pAttribute->pAttributeValue == NULL )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED;
+    }
+    else
+    {
+        /* Attribute is as expected. */
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t ParsePayloadType( const SdpAttribute_t * pAttribute,
+                                     const char * pName,
+                                     size_t nameLength,
+                                     size_t * pOffset,
+                                     uint8_t * pPayloadType )
+{
+    SdpResult_t result;
+    size_t tokenLength = 0;
+    const char * pToken = NULL;
+    uint64_t parsedValue;
+
+    result = CheckAttribute( pAttribute, pName, nameLength );
+
+    if( result == SDP_RESULT_OK )
+    {
+        *pOffset = 0;
+
+        if( ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, pOffset, &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( ParseUnsignedInteger( pToken, tokenLength, SDP_RTP_PAYLOAD_TYPE_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            *pPayloadType = ( uint8_t ) parsedValue;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t HexValue( char c )
+{
+    uint8_t value = SDP_HEX_INVALID;
+
+    if( ( c >= '0' ) && ( c <= '9' ) )
+    {
+        value = ( uint8_t ) ( c - '0' );
+    }
+    else if( ( c >= 'a' ) && ( c <= 'f' ) )
+    {
+        value = ( uint8_t ) ( ( c - 'a' ) + 10 );
+    }
+    else if( ( c >= 'A' ) && ( c <= 'F' ) )
+    {
+        value = ( uint8_t ) ( ( c - 'A' ) + 10 );
+    }
+    else
+    {
+        /* Not a hex digit. */
+    }
+
+    return value;
+}
+/*-----------------------------------------------------------*/
+
+static int DecodeHexBlock( const char * pBuffer,
+                           uint8_t * pDigest )
+{
+    uint8_t nibbles[ 3U * SDP_HEX_BLOCK_BYTES ];
+    int valid = 1;
+    size_t i;
+
+    #if defined( SDP_SIMD_SSE2 )
+        __m128i chars, lower, colons, isDigit, isLetter, isValid;
+
+        for( i = 0; i < 3U; i++ )
+        {
+            chars = _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ 16U * i ] ) );
+            colons = _mm_loadu_si128( ( const __m128i * ) &( hexBlockColonLanes[ 16U * i ] ) );
+            lower = _mm_or_si128( chars, _mm_set1_epi8( 0x20 ) );
+
+            /* Bytes of 0x80 and above are negative and fail both ranges. */
+            isDigit = _mm_and_si128( _mm_cmpgt_epi8( chars, _mm_set1_epi8( '0' - 1 ) ),
+                                     _mm_cmplt_epi8( chars, _mm_set1_epi8( '9' + 1 ) ) );
+            isLetter = _mm_and_si128( _mm_cmpgt_epi8( lower, _mm_set1_epi8( 'a' - 1 ) ),
+                                      _mm_cmplt_epi8( lower, _mm_set1_epi8( 'f' + 1 ) ) );
+            isValid = _mm_or_si128( _mm_andnot_si128( colons, _mm_or_si128( isDigit, isLetter ) ),
+                                    _mm_and_si128( colons, _mm_cmpeq_epi8( chars, _mm_set1_epi8( ':' ) ) ) );
+
+            if( _mm_movemask_epi8( isValid ) != 0xFFFF )
+            {
+                valid = 0;
+            }
+
+            _mm_storeu_si128( ( __m128i * ) &( nibbles[ 16U * i ] ),
+                              _mm_or_si128( _mm_and_si128( isDigit, _mm_sub_epi8( chars, _mm_set1_epi8( '0' ) ) ),
+                                            _mm_and_si128( isLetter, _mm_sub_epi8( lower, _mm_set1_epi8( 'a' - 10 ) ) ) ) );
+        }
+    #elif defined( SDP_SIMD_NEON )
+        uint8x16_t chars, lower, colons, isDigit, isLetter, isValid;
+
+        for( i = 0; i < 3U; i++ )
+        {
+            chars = vld1q_u8( ( const uint8_t * ) &( pBuffer[ 16U * i ] ) );
+            colons = vld1q_u8( &( hexBlockColonLanes[ 16U * i ] ) );
+            lower = vorrq_u8( chars, vdupq_n_u8( 0x20 ) );
+
+            isDigit = vandq_u8( vcgeq_u8( chars, vdupq_n_u8( ( uint8_t ) '0' ) ),
+                                vcleq_u8( chars, vdupq_n_u8( ( uint8_t ) '9' ) ) );
+            isLetter = vandq_u8( vcgeq_u8( lower, vdupq_n_u8( ( uint8_t ) 'a' ) ),
+                                 vcleq_u8( lower, vdupq_n_u8( ( uint8_t ) 'f' ) ) );
+            isValid = vbslq_u8( colons,
+                                vceqq_u8( chars, vdupq_n_u8( ( uint8_t ) ':' ) ),
+                                vorrq_u8( isDigit, isLetter ) );
+
+            if( vminvq_u8( isValid ) != 0xFFU )
+            {
+                valid = 0;
+            }
+
+            vst1q_u8( &( nibbles[ 16U * i ] ),
+                      vorrq_u8( vandq_u8( isDigit, vsubq_u8( chars, vdupq_n_u8( ( uint8_t ) '0' ) ) ),
+                                vandq_u8( isLetter, vsubq_u8( lower, vdupq_n_u8( ( uint8_t ) ( 'a' - 10 ) ) ) ) ) );
+        }
+    #else
+        for( i = 0; i < ( 3U * SDP_HEX_BLOCK_BYTES ); i++ )
+        {
+            if( hexBlockColonLanes[ i ] != 0U )
+            {
+                nibbles[ i ] = 0;
+
+                if( pBuffer[ i ] != ':' )
+                {
+                    valid = 0;
+                }
+            }
+            else
+            {
+                nibbles[ i ] = HexValue( pBuffer[ i ] );
+
+                if( nibbles[ i ] == SDP_HEX_INVALID )
+                {
+                    valid = 0;
+                }
+            }
+        }
+    #endif /* SDP_SIMD_SSE2 */
+
+    for( i = 0; i < SDP_HEX_BLOCK_BYTES; i++ )
+    {
+        pDigest[ i ] = ( uint8_t ) ( ( nibbles[ 3U * i ] << 4 ) | nibbles[ ( 3U * i ) + 1U ] );
+    }
+
+    return valid;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t VisitAttribute( const SdpVisitor_t * pVisitor,
+                                   void * pUserContext,
+                                   size_t mediaIndex,
+                                   const SdpAttribute_t * pAttribute,
+                                   SdpAttributeKind_t kind )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    int visited = 1;
+    union
+    {
+        SdpIceCandidate_t candidate;
+        SdpRtpMap_t rtpMap;
+        SdpFmtp_t fmtp;
+        SdpFingerprint_t fingerprint;
+        SdpRtcpFeedback_t rtcpFeedback;
+        SdpExtMap_t extMap;
+        SdpSsrc_t ssrc;
+        SdpSsrcGroup_t ssrcGroup;
+    } typed;
+
+    if( ( kind == SDP_ATTRIBUTE_KIND_CANDIDATE ) && ( pVisitor->onCandidate != NULL ) )
+    {
+        if( pAttribute->pAttributeValue == NULL )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else
+        {
+            result = SdpDeserializer_ParseIceCandidate( pAttribute->pAttributeValue,
+                                                        pAttribute->attributeValueLength,
+                                                        &( typed.candidate ) );
+        }
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onCandidate( pUserContext, mediaIndex, &( typed.candidate ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_RTPMAP ) && ( pVisitor->onRtpMap != NULL ) )
+    {
+        result = SdpDeserializer_ParseRtpMap( pAttribute, &( typed.rtpMap ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onRtpMap( pUserContext, mediaIndex, &( typed.rtpMap ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_FMTP ) && ( pVisitor->onFmtp != NULL ) )
+    {
+        result = SdpDeserializer_ParseFmtp( pAttribute, &( typed.fmtp ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onFmtp( pUserContext, mediaIndex, &( typed.fmtp ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_FINGERPRINT ) && ( pVisitor->onFingerprint != NULL ) )
+    {
+        result = SdpDeserializer_ParseFingerprint( pAttribute, &( typed.fingerprint ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onFingerprint( pUserContext, mediaIndex, &( typed.fingerprint ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_RTCP_FB ) && ( pVisitor->onRtcpFeedback != NULL ) )
+    {
+        result = SdpDeserializer_ParseRtcpFeedback( pAttribute, &( typed.rtcpFeedback ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onRtcpFeedback( pUserContext, mediaIndex, &( typed.rtcpFeedback ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_EXTMAP ) && ( pVisitor->onExtMap != NULL ) )
+    {
+        result = SdpDeserializer_ParseExtMap( pAttribute, &( typed.extMap ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onExtMap( pUserContext, mediaIndex, &( typed.extMap ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_SSRC ) && ( pVisitor->onSsrc != NULL ) )
+    {
+        result = SdpDeserializer_ParseSsrc( pAttribute, &( typed.ssrc ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onSsrc( pUserContext, mediaIndex, &( typed.ssrc ) );
+        }
+    }
+    else if( ( kind == SDP_ATTRIBUTE_KIND_SSRC_GROUP ) && ( pVisitor->onSsrcGroup != NULL ) )
+    {
+        result = SdpDeserializer_ParseSsrcGroup( pAttribute, &( typed.ssrcGroup ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = pVisitor->onSsrcGroup( pUserContext, mediaIndex, &( typed.ssrcGroup ) );
+        }
+    }
+    else
+    {
+        visited = 0;
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( visited == 0 ) && ( pVisitor->onAttribute != NULL ) )
+    {
+        result = pVisitor->onAttribute( pUserContext, mediaIndex, kind, pAttribute );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t WalkLines( SdpDeserializerContext_t * pCtx,
+                              const SdpVisitor_t * pVisitor,
+                              void * pUserContext,
+                              const SdpParseMask_t * pMask )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t mediaIndex = SDP_WALK_SESSION_LEVEL;
+    /* "a=" lines are selected by attributeKinds, so the "a" bit of lineTypes
+     * counts as found from the start and never keeps the walk going. */
+    uint32_t lineTypesFound = SDP_LINE_TYPE_BIT( SDP_TYPE_ATTRIBUTE ), lineTypeBit;
+    uint64_t attributeKindsFound = 0, attributeKindBit;
+    SdpAttribute_t attribute;
+    SdpAttributeKind_t kind;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+    union
+    {
+        SdpOriginator_t originator;
+        SdpTimeDescription_t timeDescription;
+        SdpConnectionInfo_t connInfo;
+        SdpBandwidthInfo_t bandwidthInfo;
+        SdpMedia_t media;
+    } typed;
+
+    while( result == SDP_RESULT_OK )
+    {
+        result = SdpDeserializer_GetNext( pCtx, &( type ), &( pValue ), &( valueLength ) );
+
+        if( result != SDP_RESULT_OK )
+        {
+            break;
+        }
+
+        /* The media index is tracked even for lines that are not visited. */
+        if( type == SDP_TYPE_MEDIA )
+        {
+            /* SDP_WALK_SESSION_LEVEL + 1 wraps around to 0. */
+            mediaIndex++;
+        }
+
+        if( ( type >= ( uint8_t ) 'a' ) && ( type <= ( uint8_t ) 'z' ) )
+        {
+            lineTypeBit = SDP_LINE_TYPE_BIT( type );
+        }
+        else
+        {
+            lineTypeBit = 0;
+        }
+
+        if( type == SDP_TYPE_ATTRIBUTE )
+        {
+            if( ( pMask == NULL ) || ( pMask->attributeKinds != 0U ) )
+            {
+                result = SdpDeserializer_ParseAttributeWithKind( pValue, valueLength, &( attribute ), &( kind ) );
+
+                if( result == SDP_RESULT_OK )
+                {
+                    attributeKindBit = SDP_ATTRIBUTE_KIND_BIT( kind );
+
+                    if( ( pMask == NULL ) || ( ( pMask->attributeKinds & attributeKindBit ) != 0U ) )
+                    {
+                        result = VisitAttribute( pVisitor, pUserContext, mediaIndex, &( attribute ), kind );
+                        attributeKindsFound |= attributeKindBit;
+                    }
+                }
+            }
+        }
+        else if( ( pMask != NULL ) && ( ( pMask->lineTypes & lineTypeBit ) == 0U ) )
+        {
+            /* Not selected, skip without parsing. */
+        }
+        else
+        {
+            lineTypesFound |= lineTypeBit;
+
+            switch( type )
+            {
+                case SDP_TYPE_ORIGINATOR:
+
+                    if( pVisitor->onOriginator != NULL )
+                    {
+                        result = SdpDeserializer_ParseOriginator( pValue, valueLength, &( typed.originator ) );
+
+                        if( result == SDP_RESULT_OK )
+                        {
+                            result = pVisitor->onOriginator( pUserContext, &( typed.originator ) );
+                        }
+                    }
+
+                    break;
+
+                case SDP_TYPE_TIME_ACTIVE:
+
+                    if( pVisitor->onTimeActive != NULL )
+                    {
+                        result = SdpDeserializer_ParseTimeActive( pValue, valueLength, &( typed.timeDescription ) );
+
+                        if( result == SDP_RESULT_OK )
+                        {
+                            result = pVisitor->onTimeActive( pUserContext, &( typed.timeDescription ) );
+                        }
+                    }
+
+                    break;
+
+                case SDP_TYPE_CONNINFO:
+
+                    if( pVisitor->onConnectionInfo != NULL )
+                    {
+                        result = SdpDeserializer_ParseConnectionInfo( pValue, valueLength, &( typed.connInfo ) );
+
+                        if( result == SDP_RESULT_OK )
+                        {
+                            result = pVisitor->onConnectionInfo( pUserContext, mediaIndex, &( typed.connInfo ) );
+                        }
+                    }
+
+                    break;
+
+                case SDP_TYPE_BANDWIDTH:
+
+                    if( pVisitor->onBandwidthInfo != NULL )
+                    {
+                        result = SdpDeserializer_ParseBandwidthInfo( pValue, valueLength, &( typed.bandwidthInfo ) );
+
+                        if( result == SDP_RESULT_OK )
+                        {
+                            result = pVisitor->onBandwidthInfo( pUserContext, mediaIndex, &( typed.bandwidthInfo ) );
+                        }
+                    }
+
+                    break;
+
+                case SDP_TYPE_MEDIA:
+
+                    if( pVisitor->onMedia != NULL )
+                    {
+                        result = SdpDeserializer_ParseMedia( pValue, valueLength, &( typed.media ) );
+
+                        if( result == SDP_RESULT_OK )
+                        {
+                            result = pVisitor->onMedia( pUserContext, mediaIndex, &( typed.media ) );
+                        }
+                    }
+
+                    break;
+
+                default:
+
+                    if( pVisitor->onLine != NULL )
+                    {
+                        result = pVisitor->onLine( pUserContext, mediaIndex, type, pValue, valueLength );
+                    }
+
+                    break;
+            }
+        }
+
+        if( ( result == SDP_RESULT_OK ) &&
+            ( pMask != NULL ) &&
+            ( ( lineTypesFound & pMask->lineTypes ) == pMask->lineTypes ) &&
+            ( ( attributeKindsFound & pMask->attributeKinds ) == pMask->attributeKinds ) )
+        {
+            /* Everything requested has been found. */
+            result = SDP_RESULT_MESSAGE_END;
+        }
+    }
+
+    if( result == SDP_RESULT_MESSAGE_END )
+    {
+        result = SDP_RESULT_OK;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
 SdpResult_t SdpDeserializer_Init( SdpDeserializerContext_t * pCtx,
                                   const char * pSdpMessage,
                                   size_t sdpMessageLength )
 {
     SdpResult_t result = SDP_RESULT_OK;
 
-    if( ( pCtx == NULL ) ||
-        ( pSdpMessage == NULL ) ||
-        ( sdpMessageLength == 0 ) )
+    if( ( pCtx == NULL ) ||
+        ( pSdpMessage == NULL ) ||
+        ( sdpMessageLength == 0 ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pCtx->pStart = pSdpMessage;
+        pCtx->totalLength = sdpMessageLength;
+        pCtx->currentIndex = 0;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_GetNext( SdpDeserializerContext_t * pCtx,
+                                     uint8_t * pType,
+                                     const char ** pValue,
+                                     size_t * pValueLength )
+{
+    size_t i, valueLength;
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( pType == NULL ) ||
+                         ( pValue == NULL ) ||
+                         ( pValueLength == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( pCtx->currentIndex == pCtx->totalLength )
+        {
+            result = SDP_RESULT_MESSAGE_END;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* Kept in trusted mode: it keeps the newline search in bounds. */
+        if( ( pCtx->totalLength - pCtx->currentIndex ) < 3U )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( SDP_CHECK_INPUT( pCtx->pStart[ pCtx->currentIndex + 1 ] != '=' ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        i = pCtx->currentIndex + 2;
+        i += FindNewline( &( pCtx->pStart[ i ] ),
+                          pCtx->totalLength - i );
+
+        if( i == pCtx->totalLength )
+        {
+            /* No '\n' found. */
+            result = SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND;
+        }
+
+        if( result == SDP_RESULT_OK )
+        {
+            if( pCtx->pStart[ i - 1 ] == '\r' )
+            {
+                valueLength = i - pCtx->currentIndex - 3;
+            }
+            else
+            {
+                valueLength = i - pCtx->currentIndex - 2;
+            }
+
+            if( SDP_CHECK_INPUT( valueLength == 0 ) )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE;
+            }
+            else
+            {
+                *pType = pCtx->pStart[ pCtx->currentIndex ];
+                *pValue = &( pCtx->pStart[ pCtx->currentIndex + 2 ] );
+                *pValueLength = valueLength;
+                pCtx->currentIndex = pCtx->currentIndex + ( i - pCtx->currentIndex ) + 1;
+            }
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_StreamInit( SdpStreamDeserializerContext_t * pCtx,
+                                        char * pCarryBuffer,
+                                        size_t carryBufferLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pCarryBuffer == NULL ) ||
+        ( carryBufferLength == 0U ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pCtx, 0, sizeof( SdpStreamDeserializerContext_t ) );
+        pCtx->pCarryBuffer = pCarryBuffer;
+        pCtx->carryBufferLength = carryBufferLength;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_StreamFeed( SdpStreamDeserializerContext_t * pCtx,
+                                        const char * pChunk,
+                                        size_t chunkLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pCarryBuffer == NULL ) ||
+        ( pCtx->chunkIndex < pCtx->chunkLength ) ||
+        ( pChunk == NULL ) ||
+        ( chunkLength == 0U ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pCtx->pChunk = pChunk;
+        pCtx->chunkLength = chunkLength;
+        pCtx->chunkIndex = 0;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_StreamGetNext( SdpStreamDeserializerContext_t * pCtx,
+                                           uint8_t * pType,
+                                           const char ** pValue,
+                                           size_t * pValueLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpDeserializerContext_t lineCtx;
+    size_t remainingLength, skipLength, lineLength;
+    int lineComplete = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pCarryBuffer == NULL ) ||
+        ( pType == NULL ) ||
+        ( pValue == NULL ) ||
+        ( pValueLength == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( pCtx->chunkIndex == pCtx->chunkLength )
+        {
+            result = SDP_RESULT_MESSAGE_END;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* As in SdpDeserializer_GetNext, the search for the end of a line
+         * starts after "<type>=", which may already be carried. */
+        remainingLength = pCtx->chunkLength - pCtx->chunkIndex;
+        skipLength = ( pCtx->carryLength >= 2U ) ? 0U : ( 2U - pCtx->carryLength );
+        lineLength = remainingLength;
+
+        if( remainingLength > skipLength )
+        {
+            lineLength = skipLength + FindNewline( &( pCtx->pChunk[ pCtx->chunkIndex + skipLength ] ),
+                                                   remainingLength - skipLength );
+        }
+
+        if( lineLength < remainingLength )
+        {
+            /* Include the '\n'. */
+            lineLength++;
+            lineComplete = 1;
+        }
+
+        if( ( lineComplete != 0 ) && ( pCtx->carryLength == 0U ) )
+        {
+            /* The whole line is in the chunk, no copy needed. */
+            lineCtx.pStart = &( pCtx->pChunk[ pCtx->chunkIndex ] );
+            lineCtx.totalLength = lineLength;
+            lineCtx.currentIndex = 0;
+            pCtx->chunkIndex += lineLength;
+        }
+        else if( lineLength > ( pCtx->carryBufferLength - pCtx->carryLength ) )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            ( void ) memcpy( &( pCtx->pCarryBuffer[ pCtx->carryLength ] ),
+                             &( pCtx->pChunk[ pCtx->chunkIndex ] ),
+                             lineLength );
+            pCtx->carryLength += lineLength;
+            pCtx->chunkIndex += lineLength;
+
+            if( lineComplete == 0 )
+            {
+                /* Wait for the rest of the line in the next chunk. */
+                result = SDP_RESULT_MESSAGE_END;
+            }
+            else
+            {
+                lineCtx.pStart = pCtx->pCarryBuffer;
+                lineCtx.totalLength = pCtx->carryLength;
+                lineCtx.currentIndex = 0;
+                pCtx->carryLength = 0;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        result = SdpDeserializer_GetNext( &( lineCtx ), pType, pValue, pValueLength );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_StreamFinish( const SdpStreamDeserializerContext_t * pCtx )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->chunkIndex < pCtx->chunkLength ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else if( pCtx->carryLength == 0U )
+    {
+        /* Every line was complete. */
+    }
+    else if( pCtx->carryLength < 3U )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+    }
+    else if( pCtx->pCarryBuffer[ 1 ] != '=' )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND;
+    }
+    else
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_InitSegments( SdpSegmentDeserializerContext_t * pCtx,
+                                          const SdpBufferSegment_t * pSegments,
+                                          size_t segmentCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i;
+
+    if( ( pCtx == NULL ) ||
+        ( ( pSegments == NULL ) && ( segmentCount > 0U ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < segmentCount ); i++ )
+    {
+        if( ( pSegments[ i ].pBuffer == NULL ) && ( pSegments[ i ].bufferLength > 0U ) )
+        {
+            result = SDP_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pCtx->pSegments = pSegments;
+        pCtx->segmentCount = segmentCount;
+        pCtx->segmentIndex = 0;
+        result = SdpDeserializer_StreamInit( &( pCtx->streamContext ),
+                                             pCtx->stitchBuffer,
+                                             SDP_SEGMENT_STITCH_BUFFER_LENGTH );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_InitRingBuffer( SdpSegmentDeserializerContext_t * pCtx,
+                                            const char * pBuffer,
+                                            size_t bufferLength,
+                                            size_t readIndex,
+                                            size_t messageLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t firstLength;
+
+    if( ( pCtx == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( readIndex >= bufferLength ) ||
+        ( messageLength > bufferLength ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        firstLength = bufferLength - readIndex;
+
+        if( firstLength > messageLength )
+        {
+            firstLength = messageLength;
+        }
+
+        pCtx->ringSegments[ 0 ].pBuffer = &( pBuffer[ readIndex ] );
+        pCtx->ringSegments[ 0 ].bufferLength = firstLength;
+        pCtx->ringSegments[ 1 ].pBuffer = pBuffer;
+        pCtx->ringSegments[ 1 ].bufferLength = messageLength - firstLength;
+
+        result = SdpDeserializer_InitSegments( pCtx, pCtx->ringSegments, 2 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_GetNextFromSegments( SdpSegmentDeserializerContext_t * pCtx,
+                                                 uint8_t * pType,
+                                                 const char ** pValue,
+                                                 size_t * pValueLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = SdpDeserializer_StreamGetNext( &( pCtx->streamContext ), pType, pValue, pValueLength );
+    }
+
+    /* Move to the next non-empty segment whenever the current one is used up. */
+    while( ( result == SDP_RESULT_MESSAGE_END ) && ( pCtx->segmentIndex < pCtx->segmentCount ) )
+    {
+        if( pCtx->pSegments[ pCtx->segmentIndex ].bufferLength > 0U )
+        {
+            result = SdpDeserializer_StreamFeed( &( pCtx->streamContext ),
+                                                 pCtx->pSegments[ pCtx->segmentIndex ].pBuffer,
+                                                 pCtx->pSegments[ pCtx->segmentIndex ].bufferLength );
+
+            if( result == SDP_RESULT_OK )
+            {
+                result = SdpDeserializer_StreamGetNext( &( pCtx->streamContext ), pType, pValue, pValueLength );
+            }
+        }
+
+        pCtx->segmentIndex++;
+    }
+
+    if( result == SDP_RESULT_MESSAGE_END )
+    {
+        /* All segments are used up, report a truncated last line. */
+        result = SdpDeserializer_StreamFinish( &( pCtx->streamContext ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_END;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_IndexLines( const SdpDeserializerContext_t * pCtx,
+                                        SdpLineInfo_t * pLines,
+                                        size_t maxLines,
+                                        size_t * pLineCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t blockStart, blockLength, lineStart, newline, lineCount = 0, valueLength, i;
+    uint64_t mask;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pStart == NULL ) ||
+        ( pCtx->currentIndex > pCtx->totalLength ) ||
+        ( pLineCount == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        lineStart = pCtx->currentIndex;
+
+        for( blockStart = pCtx->currentIndex;
+             ( result == SDP_RESULT_OK ) && ( blockStart < pCtx->totalLength );
+             blockStart += blockLength )
+        {
+            blockLength = pCtx->totalLength - blockStart;
+
+            if( blockLength >= 64U )
+            {
+                blockLength = 64U;
+                mask = NewlineMask64( &( pCtx->pStart[ blockStart ] ) );
+            }
+            else
+            {
+                mask = 0;
+
+                for( i = 0; i < blockLength; i++ )
+                {
+                    if( pCtx->pStart[ blockStart + i ] == '\n' )
+                    {
+                        mask |= ( ( uint64_t ) 1U ) << i;
+                    }
+                }
+            }
+
+            while( ( result == SDP_RESULT_OK ) && ( mask != 0U ) )
+            {
+                newline = blockStart + CountTrailingZeros( mask );
+                mask &= mask - 1U;
+
+                /* As in SdpDeserializer_GetNext, the search for the end of a
+                 * line starts after "<type>=". */
+                if( newline >= ( lineStart + 2U ) )
+                {
+                    if( pCtx->pStart[ lineStart + 1U ] != '=' )
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND;
+                    }
+                    else
+                    {
+                        valueLength = newline - lineStart - 2U;
+
+                        if( pCtx->pStart[ newline - 1U ] == '\r' )
+                        {
+                            valueLength--;
+                        }
+
+                        if( valueLength == 0U )
+                        {
+                            result = SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE;
+                        }
+                    }
+
+                    if( result == SDP_RESULT_OK )
+                    {
+                        if( ( pLines != NULL ) && ( lineCount < maxLines ) )
+                        {
+                            pLines[ lineCount ].type = ( uint8_t ) pCtx->pStart[ lineStart ];
+                            pLines[ lineCount ].valueOffset = lineStart + 2U;
+                            pLines[ lineCount ].valueLength = valueLength;
+                        }
+
+                        lineCount++;
+                        lineStart = newline + 1U;
+                    }
+                }
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* Classify trailing bytes without a newline the same way
+         * SdpDeserializer_GetNext does. */
+        if( lineStart < pCtx->totalLength )
+        {
+            if( ( pCtx->totalLength - lineStart ) < 3U )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+            }
+            else if( pCtx->pStart[ lineStart + 1U ] != '=' )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND;
+            }
+            else
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND;
+            }
+        }
+        else if( ( pLines != NULL ) && ( lineCount > maxLines ) )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( pLineCount != NULL )
+    {
+        *pLineCount = lineCount;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_IndexMediaSections( const SdpDeserializerContext_t * pCtx,
+                                                SdpMediaSectionInfo_t * pSections,
+                                                size_t maxSections,
+                                                size_t * pSectionCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpDeserializerContext_t scanCtx;
+    SdpMediaSectionInfo_t * pSection = NULL;
+    size_t sectionCount = 0, lineStart, valueLength;
+    const char * pValue;
+    uint8_t type;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pStart == NULL ) ||
+        ( pCtx->currentIndex > pCtx->totalLength ) ||
+        ( pSectionCount == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        scanCtx = *pCtx;
+
+        while( result == SDP_RESULT_OK )
+        {
+            lineStart = scanCtx.currentIndex;
+            result = SdpDeserializer_GetNext( &( scanCtx ), &( type ), &( pValue ), &( valueLength ) );
+
+            if( result != SDP_RESULT_OK )
+            {
+                break;
+            }
+
+            if( type == SDP_TYPE_MEDIA )
+            {
+                /* Sections beyond maxSections are counted but not stored. */
+                pSection = NULL;
+
+                if( ( pSections != NULL ) && ( sectionCount < maxSections ) )
+                {
+                    pSection = &( pSections[ sectionCount ] );
+                    ( void ) memset( pSection, 0, sizeof( SdpMediaSectionInfo_t ) );
+                    pSection->startOffset = lineStart;
+                }
+
+                sectionCount++;
+            }
+
+            if( pSection != NULL )
+            {
+                pSection->endOffset = scanCtx.currentIndex;
+
+                if( type == SDP_TYPE_ATTRIBUTE )
+                {
+                    pSection->attributeCount++;
+
+                    if( ( valueLength >= 10U ) &&
+                        ( memcmp( pValue, "candidate:", 10U ) == 0 ) )
+                    {
+                        pSection->candidateCount++;
+                    }
+                }
+                else if( type == SDP_TYPE_BANDWIDTH )
+                {
+                    pSection->bandwidthInfoCount++;
+                }
+                else if( type == SDP_TYPE_CONNINFO )
+                {
+                    pSection->connectionInfoCount++;
+                }
+                else
+                {
+                    /* Not counted. */
+                }
+            }
+        }
+
+        if( result == SDP_RESULT_MESSAGE_END )
+        {
+            result = SDP_RESULT_OK;
+
+            if( ( pSections != NULL ) && ( sectionCount > maxSections ) )
+            {
+                result = SDP_RESULT_OUT_OF_MEMORY;
+            }
+        }
+    }
+
+    if( pSectionCount != NULL )
+    {
+        *pSectionCount = sectionCount;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ScanPrefixes( const SdpDeserializerContext_t * pCtx,
+                                          const SdpScanPattern_t * pPatterns,
+                                          size_t patternCount,
+                                          SdpScanMatch_t * pMatches,
+                                          size_t maxMatches,
+                                          size_t * pMatchCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    uint32_t keyBytes[ 8 ] = { 0 };
+    size_t matchCount = 0, commonLength = 0, lineStart, lineEnd, lineLength, valueEnd, matchIndex, i;
+    uint8_t keyByte, isCandidate;
+    uint8_t useKeyBytes = 1;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pStart == NULL ) ||
+        ( pPatterns == NULL ) ||
+        ( patternCount == 0U ) ||
+        ( pMatchCount == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < patternCount ); i++ )
+    {
+        if( ( pPatterns[ i ].pPrefix == NULL ) ||
+            ( pPatterns[ i ].prefixLength == 0U ) )
+        {
+            result = SDP_RESULT_BAD_PARAM;
+        }
+        else if( i == 0U )
+        {
+            commonLength = pPatterns[ 0 ].prefixLength;
+        }
+        else
+        {
+            /* Shorten the prefix shared by all patterns, e.g. "a=". */
+            if( pPatterns[ i ].prefixLength < commonLength )
+            {
+                commonLength = pPatterns[ i ].prefixLength;
+            }
+
+            while( ( commonLength > 0U ) &&
+                   ( memcmp( pPatterns[ i ].pPrefix, pPatterns[ 0 ].pPrefix, commonLength ) != 0 ) )
+            {
+                commonLength--;
+            }
+        }
+    }
+
+    /* The first byte after the shared prefix is where the patterns differ.
+     * Collect the set of those bytes, so one lookup rejects a line that starts
+     * with the shared prefix but cannot match any pattern. This only works if
+     * no pattern ends with the shared prefix. */
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < patternCount ); i++ )
+    {
+        if( pPatterns[ i ].prefixLength == commonLength )
+        {
+            useKeyBytes = 0;
+        }
+        else
+        {
+            keyByte = ( uint8_t ) pPatterns[ i ].pPrefix[ commonLength ];
+            keyBytes[ keyByte >> 5 ] |= ( uint32_t ) 1U << ( keyByte & 31U );
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        lineStart = pCtx->currentIndex;
+
+        while( lineStart < pCtx->totalLength )
+        {
+            lineEnd = lineStart + FindNewline( &( pCtx->pStart[ lineStart ] ),
+                                               pCtx->totalLength - lineStart );
+            lineLength = lineEnd - lineStart;
+            matchIndex = patternCount;
+
+            if( ( lineLength >= commonLength ) &&
+                ( memcmp( &( pCtx->pStart[ lineStart ] ), pPatterns[ 0 ].pPrefix, commonLength ) == 0 ) )
+            {
+                if( useKeyBytes == 0U )
+                {
+                    isCandidate = 1;
+                }
+                else if( lineLength > commonLength )
+                {
+                    keyByte = ( uint8_t ) pCtx->pStart[ lineStart + commonLength ];
+                    isCandidate = ( ( keyBytes[ keyByte >> 5 ] & ( ( uint32_t ) 1U << ( keyByte & 31U ) ) ) != 0U ) ? 1U : 0U;
+                }
+                else
+                {
+                    isCandidate = 0;
+                }
+            }
+            else
+            {
+                isCandidate = 0;
+            }
+
+            /* The longest matching pattern wins, so that e.g. "a=ssrc" and
+             * "a=ssrc-group" can be scanned for together. */
+            for( i = 0; ( isCandidate != 0U ) && ( i < patternCount ); i++ )
+            {
+                if( ( pPatterns[ i ].prefixLength <= lineLength ) &&
+                    ( ( matchIndex == patternCount ) || ( pPatterns[ i ].prefixLength > pPatterns[ matchIndex ].prefixLength ) ) &&
+                    ( memcmp( &( pCtx->pStart[ lineStart + commonLength ] ),
+                              &( pPatterns[ i ].pPrefix[ commonLength ] ),
+                              pPatterns[ i ].prefixLength - commonLength ) == 0 ) )
+                {
+                    matchIndex = i;
+                }
+            }
+
+            if( matchIndex < patternCount )
+            {
+                if( ( pMatches != NULL ) && ( matchCount < maxMatches ) )
+                {
+                    valueEnd = lineEnd;
+
+                    if( ( valueEnd > ( lineStart + pPatterns[ matchIndex ].prefixLength ) ) &&
+                        ( pCtx->pStart[ valueEnd - 1U ] == '\r' ) )
+                    {
+                        valueEnd--;
+                    }
+
+                    pMatches[ matchCount ].patternIndex = matchIndex;
+                    pMatches[ matchCount ].pLine = &( pCtx->pStart[ lineStart ] );
+                    pMatches[ matchCount ].lineLength = valueEnd - lineStart;
+                    pMatches[ matchCount ].pValue = &( pCtx->pStart[ lineStart + pPatterns[ matchIndex ].prefixLength ] );
+                    pMatches[ matchCount ].valueLength = valueEnd - lineStart - pPatterns[ matchIndex ].prefixLength;
+                }
+
+                matchCount++;
+            }
+
+            /* Skip the '\n'. */
+            lineStart = lineEnd + 1U;
+        }
+
+        if( ( pMatches != NULL ) && ( matchCount > maxMatches ) )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+
+        *pMatchCount = matchCount;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseOriginator( const char * pValue,
+                                             size_t valueLength,
+                                             SdpOriginator_t * pOriginator )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, start = 0, numSpaces = 0;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pOriginator == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ' ' )
+            {
+                numSpaces += 1;
+
+                if( numSpaces == 1 )
+                {
+                    pOriginator->pUserName = &( pValue[ start ] );
+                    pOriginator->userNameLength = i - start;
+                }
+                else if( numSpaces == 2 )
+                {
+                    if( ParseUnsignedInteger( &( pValue[ start ] ),
+                                              i - start,
+                                              UINT64_MAX,
+                                              &( pOriginator->sessionId ) ) != SDP_RESULT_OK )
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_ID;
+                        break;
+                    }
+                }
+                else /* numSpaces == 3 */
+                {
+                    if( ParseUnsignedInteger( &( pValue[ start ] ),
+                                              i - start,
+                                              UINT64_MAX,
+                                              &( pOriginator->sessionVersion ) ) != SDP_RESULT_OK )
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION;
+                        break;
+                    }
+                    else
+                    {
+                        /* Skip over space. */
+                        start = i + 1;
+
+                        /* break to parse connection info inside of originator. */
+                        break;
+                    }
+                }
+
+                start = i + 1;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( i < valueLength )
+        {
+            /* Originator part is parsed, continue to parse connection info. */
+            result = SdpDeserializer_ParseConnectionInfo( &( pValue[ start ] ),
+                                                          valueLength - start,
+                                                          &( pOriginator->connectionInfo ) );
+        }
+        else
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseConnectionInfo( const char * pValue,
+                                                 size_t valueLength,
+                                                 SdpConnectionInfo_t * pConnInfo )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, start = 0, numSpaces = 0;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pConnInfo == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ' ' )
+            {
+                numSpaces += 1;
+
+                if( numSpaces == 1 )
+                {
+                    if( ( i - start ) == 2 )
+                    {
+                        if( strncmp( &( pValue[ start ] ), "IN", 2 ) == 0 )
+                        {
+                            pConnInfo->networkType = SDP_NETWORK_IN;
+                        }
+                        else
+                        {
+                            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_NETWORK_TYPE;
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_NETWORK_TYPE;
+                        break;
+                    }
+                }
+                else if( numSpaces == 2 )
+                {
+                    if( ( i - start ) == 3 )
+                    {
+                        if( strncmp( &( pValue[ start ] ), "IP4", 3 ) == 0 )
+                        {
+                            pConnInfo->addressType = SDP_ADDRESS_IPV4;
+                        }
+                        else if( strncmp( &( pValue[ start ] ), "IP6", 3 ) == 0 )
+                        {
+                            pConnInfo->addressType = SDP_ADDRESS_IPV6;
+                        }
+                        else
+                        {
+                            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_ADDRESS_TYPE;
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_ADDRESS_TYPE;
+                        break;
+                    }
+                }
+                else
+                {
+                    result = SDP_RESULT_MESSAGE_MALFORMED_REDUNDANT_INFO;
+                }
+
+                start = i + 1;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( numSpaces == 2 )
+        {
+            pConnInfo->pAddress = &( pValue[ start ] );
+            pConnInfo->addressLength = i - start;
+        }
+        else
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseBandwidthInfo( const char * pValue,
+                                                size_t valueLength,
+                                                SdpBandwidthInfo_t * pBandwidthInfo )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, numColon = 0;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pBandwidthInfo == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ':' )
+            {
+                numColon += 1;
+                pBandwidthInfo->pBwType = &( pValue[ 0 ] );
+                pBandwidthInfo->bwTypeLength = i;
+
+                if( ParseUnsignedInteger( &( pValue[ i + 1 ] ),
+                                          valueLength - ( i + 1 ),
+                                          UINT64_MAX,
+                                          &( pBandwidthInfo->sdpBandwidthValue ) ) != SDP_RESULT_OK )
+                {
+                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_BANDWIDTH;
+                }
+
+                break;
+            }
+        }
+
+        if( numColon == 0 )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseTimeActive( const char * pValue,
+                                             size_t valueLength,
+                                             SdpTimeDescription_t * pTimeDescription )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, numSpaces = 0;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pTimeDescription == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ' ' )
+            {
+                numSpaces += 1;
+
+                /* Parse start-time. */
+                if( ParseUnsignedInteger( &( pValue[ 0 ] ),
+                                          i,
+                                          UINT64_MAX,
+                                          &( pTimeDescription->startTime ) ) != SDP_RESULT_OK )
+                {
+                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_START_TIME;
+                    break;
+                }
+
+                /* Parse stop-time. */
+                if( ParseUnsignedInteger( &( pValue[ i + 1 ] ),
+                                          valueLength - ( i + 1 ),
+                                          UINT64_MAX,
+                                          &( pTimeDescription->stopTime ) ) != SDP_RESULT_OK )
+                {
+                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_STOP_TIME;
+                }
+
+                break;
+            }
+        }
+
+        if( numSpaces == 0 )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseAttribute( const char * pValue,
+                                            size_t valueLength,
+                                            SdpAttribute_t * pAttribute )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pAttribute == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ':' )
+            {
+                pAttribute->pAttributeName = &( pValue[ 0 ] );
+                pAttribute->attributeNameLength = i;
+
+                pAttribute->pAttributeValue = &( pValue[ i + 1 ] );
+                pAttribute->attributeValueLength = valueLength - ( i + 1 );
+                break;
+            }
+        }
+
+        /* No ':' in this attribute. */
+        if( i == valueLength )
+        {
+            pAttribute->pAttributeName = &( pValue[ 0 ] );
+            pAttribute->attributeNameLength = valueLength;
+
+            pAttribute->pAttributeValue = NULL;
+            pAttribute->attributeValueLength = 0;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpAttributeKind_t SdpDeserializer_GetAttributeKind( const char * pAttributeName,
+                                                     size_t attributeNameLength )
+{
+    SdpAttributeKind_t kind = SDP_ATTRIBUTE_KIND_UNKNOWN;
+    uint8_t candidateKind;
+
+    if( ( pAttributeName != NULL ) &&
+        ( attributeNameLength >= SDP_ATTRIBUTE_NAME_MIN_LENGTH ) &&
+        ( attributeNameLength <= SDP_ATTRIBUTE_NAME_MAX_LENGTH ) )
+    {
+        candidateKind = attributeKindTable[ SDP_ATTRIBUTE_NAME_HASH( pAttributeName, attributeNameLength ) ];
+
+        if( ( attributeNames[ candidateKind ].nameLength == attributeNameLength ) &&
+            ( memcmp( attributeNames[ candidateKind ].pName, pAttributeName, attributeNameLength ) == 0 ) )
+        {
+            kind = ( SdpAttributeKind_t ) candidateKind;
+        }
+    }
+
+    return kind;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseAttributeWithKind( const char * pValue,
+                                                    size_t valueLength,
+                                                    SdpAttribute_t * pAttribute,
+                                                    SdpAttributeKind_t * pKind )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( pKind == NULL )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        result = SdpDeserializer_ParseAttribute( pValue, valueLength, pAttribute );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *pKind = SdpDeserializer_GetAttributeKind( pAttribute->pAttributeName, pAttribute->attributeNameLength );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseMedia( const char * pValue,
+                                        size_t valueLength,
+                                        SdpMedia_t * pMedia )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, j, start = 0, numSpaces = 0;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pMedia == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < valueLength; i++ )
+        {
+            if( pValue[ i ] == ' ' )
+            {
+                numSpaces += 1;
+
+                if( numSpaces == 1 )
+                {
+                    pMedia->pMedia = &( pValue[ start ] );
+                    pMedia->mediaLength = i - start;
+                }
+                else if( numSpaces == 2 )
+                {
+                    /* <port> or <port>/<number of ports>. */
+                    for( j = start; j < i; j++ )
+                    {
+                        if( pValue[ j ] == '/' )
+                        {
+                            break;
+                        }
+                    }
+
+                    if( ParseUnsignedInteger( &( pValue[ start ] ),
+                                              j - start,
+                                              UINT16_MAX,
+                                              &( parsedValue ) ) != SDP_RESULT_OK )
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORT;
+                        break;
+                    }
+
+                    pMedia->port = ( uint16_t ) parsedValue;
+                    pMedia->portNum = 0;
+
+                    if( j < i )
+                    {
+                        if( ParseUnsignedInteger( &( pValue[ j + 1 ] ),
+                                                  i - ( j + 1 ),
+                                                  UINT16_MAX,
+                                                  &( parsedValue ) ) != SDP_RESULT_OK )
+                        {
+                            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORTNUM;
+                            break;
+                        }
+
+                        pMedia->portNum = ( uint16_t ) parsedValue;
+                    }
+                }
+                else /* numSpaces == 3 */
+                {
+                    pMedia->pProtocol = &( pValue[ start ] );
+                    pMedia->protocolLength = i - start;
+
+                    /* Skip last ' ' in protocol. */
+                    start = i + 1;
+                    break;
+                }
+
+                start = i + 1;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( i < valueLength )
+        {
+            pMedia->pFmt = &( pValue[ start ] );
+            pMedia->fmtLength = valueLength - start;
+        }
+        else
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseIceCandidate( const char * pValue,
+                                               size_t valueLength,
+                                               SdpIceCandidate_t * pCandidate )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, tokenLength = 0, nameLength = 0;
+    const char * pToken = NULL;
+    const char * pName = NULL;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pValue == NULL ) ||
+        ( pCandidate == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pCandidate, 0, sizeof( SdpIceCandidate_t ) );
+
+        if( ( valueLength >= 10U ) &&
+            ( memcmp( pValue, "candidate:", 10U ) == 0 ) )
+        {
+            offset = 10U;
+        }
+
+        /* foundation SP component-id SP transport SP priority SP
+         * connection-address SP port SP "typ" SP cand-type */
+        if( NextToken( pValue, valueLength, &( offset ), &( pCandidate->pFoundation ), &( pCandidate->foundationLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( ( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( ParseUnsignedInteger( pToken, tokenLength, UINT16_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else
+        {
+            pCandidate->componentId = ( uint16_t ) parsedValue;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pValue, valueLength, &( offset ), &( pCandidate->pTransport ), &( pCandidate->transportLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( ( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( ParseUnsignedInteger( pToken, tokenLength, UINT32_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else
+        {
+            pCandidate->priority = ( uint32_t ) parsedValue;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pValue, valueLength, &( offset ), &( pCandidate->pAddress ), &( pCandidate->addressLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( ( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( ParseUnsignedInteger( pToken, tokenLength, UINT16_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else
+        {
+            pCandidate->port = ( uint16_t ) parsedValue;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( ( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( TokenEquals( pToken, tokenLength, "typ", 3U ) == 0 ) ||
+            ( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else if( TokenEquals( pToken, tokenLength, "host", 4U ) != 0 )
+        {
+            pCandidate->candidateType = SDP_ICE_CANDIDATE_TYPE_HOST;
+        }
+        else if( TokenEquals( pToken, tokenLength, "srflx", 5U ) != 0 )
+        {
+            pCandidate->candidateType = SDP_ICE_CANDIDATE_TYPE_SRFLX;
+        }
+        else if( TokenEquals( pToken, tokenLength, "prflx", 5U ) != 0 )
+        {
+            pCandidate->candidateType = SDP_ICE_CANDIDATE_TYPE_PRFLX;
+        }
+        else if( TokenEquals( pToken, tokenLength, "relay", 5U ) != 0 )
+        {
+            pCandidate->candidateType = SDP_ICE_CANDIDATE_TYPE_RELAY;
+        }
+        else
+        {
+            pCandidate->candidateType = SDP_ICE_CANDIDATE_TYPE_UNKNOWN;
+        }
+    }
+
+    /* The rest is a list of "<name> SP <value>" pairs. */
+    while( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pValue, valueLength, &( offset ), &( pName ), &( nameLength ) ) != SDP_RESULT_OK )
+        {
+            break;
+        }
+
+        if( NextToken( pValue, valueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK )
+        {
+            /* Name without a value. */
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+        }
+        else if( TokenEquals( pName, nameLength, "raddr", 5U ) != 0 )
+        {
+            pCandidate->pRelatedAddress = pToken;
+            pCandidate->relatedAddressLength = tokenLength;
+        }
+        else if( TokenEquals( pName, nameLength, "rport", 5U ) != 0 )
+        {
+            if( ParseUnsignedInteger( pToken, tokenLength, UINT16_MAX, &( parsedValue ) ) != SDP_RESULT_OK )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE;
+            }
+            else
+            {
+                pCandidate->relatedPort = ( uint16_t ) parsedValue;
+            }
+        }
+        else if( TokenEquals( pName, nameLength, "tcptype", 7U ) != 0 )
+        {
+            pCandidate->pTcpType = pToken;
+            pCandidate->tcpTypeLength = tokenLength;
+        }
+        else if( pCandidate->extensionCount == SDP_ICE_CANDIDATE_MAX_EXTENSIONS )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pCandidate->extensions[ pCandidate->extensionCount ].pName = pName;
+            pCandidate->extensions[ pCandidate->extensionCount ].nameLength = nameLength;
+            pCandidate->extensions[ pCandidate->extensionCount ].pValue = pToken;
+            pCandidate->extensions[ pCandidate->extensionCount ].valueLength = tokenLength;
+            pCandidate->extensionCount++;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseRtpMap( const SdpAttribute_t * pAttribute,
+                                         SdpRtpMap_t * pRtpMap )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, tokenLength = 0, rateLength;
+    const char * pToken = NULL;
+    const char * pSlash;
+    const char * pRate;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pRtpMap == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pRtpMap, 0, sizeof( SdpRtpMap_t ) );
+
+        /* <payload type> SP <encoding name>/<clock rate>[/<encoding parameters>] */
+        result = ParsePayloadType( pAttribute, "rtpmap", 6U, &( offset ), &( pRtpMap->payloadType ) );
+
+        if( result == SDP_RESULT_MESSAGE_MALFORMED )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+        }
+        else
+        {
+            pSlash = memchr( pToken, '/', tokenLength );
+
+            if( ( pSlash == NULL ) || ( pSlash == pToken ) )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+            }
+            else
+            {
+                pRtpMap->pEncodingName = pToken;
+                pRtpMap->encodingNameLength = ( size_t ) ( pSlash - pToken );
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pRate = pSlash + 1;
+        rateLength = tokenLength - ( pRtpMap->encodingNameLength + 1U );
+        pSlash = memchr( pRate, '/', rateLength );
+
+        if( pSlash != NULL )
+        {
+            if( ParseUnsignedInteger( pSlash + 1, rateLength - ( size_t ) ( ( pSlash + 1 ) - pRate ), UINT16_MAX, &( parsedValue ) ) != SDP_RESULT_OK )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+            }
+            else
+            {
+                pRtpMap->channels = ( uint16_t ) parsedValue;
+                rateLength = ( size_t ) ( pSlash - pRate );
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( ParseUnsignedInteger( pRate, rateLength, UINT32_MAX, &( parsedValue ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+        }
+        else
+        {
+            pRtpMap->clockRate = ( uint32_t ) parsedValue;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* Nothing may follow the encoding. */
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_MESSAGE_END )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseFmtp( const SdpAttribute_t * pAttribute,
+                                       SdpFmtp_t * pFmtp )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t start = 0, end;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pFmtp == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pFmtp, 0, sizeof( SdpFmtp_t ) );
+
+        /* <format> SP <format specific parameters> */
+        result = ParsePayloadType( pAttribute, "fmtp", 4U, &( start ), &( pFmtp->payloadType ) );
+
+        if( result == SDP_RESULT_MESSAGE_MALFORMED )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        end = pAttribute->attributeValueLength;
+        TrimSpaces( pAttribute->pAttributeValue, &( start ), &( end ) );
+
+        if( start == end )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP;
+        }
+        else
+        {
+            pFmtp->pParameters = &( pAttribute->pAttributeValue[ start ] );
+            pFmtp->parametersLength = end - start;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_GetNextFmtpParameter( const SdpFmtp_t * pFmtp,
+                                                  size_t * pOffset,
+                                                  SdpFmtpParameter_t * pParameter )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t start, end, keyEnd, valueStart;
+    const char * pSeparator;
+    const char * pEqual;
+
+    /* Input check. */
+    if( ( pFmtp == NULL ) ||
+        ( pFmtp->pParameters == NULL ) ||
+        ( pOffset == NULL ) ||
+        ( pParameter == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = SDP_RESULT_MESSAGE_END;
+    }
+
+    while( ( result == SDP_RESULT_MESSAGE_END ) && ( *pOffset < pFmtp->parametersLength ) )
+    {
+        start = *pOffset;
+        pSeparator = memchr( &( pFmtp->pParameters[ start ] ), ';', pFmtp->parametersLength - start );
+
+        if( pSeparator == NULL )
+        {
+            end = pFmtp->parametersLength;
+            *pOffset = end;
+        }
+        else
+        {
+            end = ( size_t ) ( pSeparator - pFmtp->pParameters );
+            *pOffset = end + 1U;
+        }
+
+        TrimSpaces( pFmtp->pParameters, &( start ), &( end ) );
+
+        /* Empty parameters, e.g. after a trailing ';', are skipped. */
+        if( start != end )
+        {
+            pEqual = memchr( &( pFmtp->pParameters[ start ] ), '=', end - start );
+
+            if( pEqual == NULL )
+            {
+                keyEnd = end;
+                pParameter->pValue = NULL;
+                pParameter->valueLength = 0;
+            }
+            else
+            {
+                keyEnd = ( size_t ) ( pEqual - pFmtp->pParameters );
+                valueStart = keyEnd + 1U;
+                TrimSpaces( pFmtp->pParameters, &( start ), &( keyEnd ) );
+                TrimSpaces( pFmtp->pParameters, &( valueStart ), &( end ) );
+                pParameter->pValue = &( pFmtp->pParameters[ valueStart ] );
+                pParameter->valueLength = end - valueStart;
+            }
+
+            if( keyEnd == start )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP;
+            }
+            else
+            {
+                pParameter->pKey = &( pFmtp->pParameters[ start ] );
+                pParameter->keyLength = keyEnd - start;
+                result = SDP_RESULT_OK;
+            }
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseFingerprint( const SdpAttribute_t * pAttribute,
+                                              SdpFingerprint_t * pFingerprint )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, hexLength = 0, i, j;
+    const char * pHex = NULL;
+    const char * pToken = NULL;
+    size_t tokenLength = 0;
+    char lastBlock[ 3U * SDP_HEX_BLOCK_BYTES ];
+    char c;
+    uint8_t high, low;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pFingerprint == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = CheckAttribute( pAttribute, "fingerprint", 11U );
+
+        if( result == SDP_RESULT_MESSAGE_MALFORMED )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pFingerprint, 0, sizeof( SdpFingerprint_t ) );
+        pFingerprint->hashFunction = SDP_FINGERPRINT_HASH_UNKNOWN;
+
+        /* <hash-func> SP <fingerprint> */
+        if( ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pFingerprint->pHashName ), &( pFingerprint->hashNameLength ) ) != SDP_RESULT_OK ) ||
+            ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pHex ), &( hexLength ) ) != SDP_RESULT_OK ) ||
+            ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_MESSAGE_END ) ||
+            ( ( ( hexLength + 1U ) % 3U ) != 0U ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT;
+        }
+        else if( ( ( hexLength + 1U ) / 3U ) > SDP_FINGERPRINT_MAX_DIGEST_LENGTH )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pFingerprint->digestLength = ( hexLength + 1U ) / 3U;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < ( sizeof( fingerprintHashes ) / sizeof( fingerprintHashes[ 0 ] ) ); i++ )
+        {
+            if( fingerprintHashes[ i ].nameLength == pFingerprint->hashNameLength )
+            {
+                for( j = 0; j < pFingerprint->hashNameLength; j++ )
+                {
+                    c = pFingerprint->pHashName[ j ];
+
+                    if( ( c >= 'A' ) && ( c <= 'Z' ) )
+                    {
+                        c = ( char ) ( c + ( 'a' - 'A' ) );
+                    }
+
+                    if( c != fingerprintHashes[ i ].pName[ j ] )
+                    {
+                        break;
+                    }
+                }
+
+                if( j == pFingerprint->hashNameLength )
+                {
+                    pFingerprint->hashFunction = fingerprintHashes[ i ].hashFunction;
+
+                    if( pFingerprint->digestLength != fingerprintHashes[ i ].digestLength )
+                    {
+                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT;
+                    }
+
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Decode 16 bytes at a time. The last group has no ':' after it, so a
+     * final full block is copied and terminated. */
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( ( pFingerprint->digestLength - i ) >= SDP_HEX_BLOCK_BYTES ); i += SDP_HEX_BLOCK_BYTES )
+    {
+        if( ( hexLength - ( 3U * i ) ) >= sizeof( lastBlock ) )
+        {
+            pToken = &( pHex[ 3U * i ] );
+        }
+        else
+        {
+            ( void ) memcpy( lastBlock, &( pHex[ 3U * i ] ), sizeof( lastBlock ) - 1U );
+            lastBlock[ sizeof( lastBlock ) - 1U ] = ':';
+            pToken = lastBlock;
+        }
+
+        if( DecodeHexBlock( pToken, &( pFingerprint->digest[ i ] ) ) == 0 )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT;
+        }
+    }
+
+    for( ; ( result == SDP_RESULT_OK ) && ( i < pFingerprint->digestLength ); i++ )
+    {
+        high = HexValue( pHex[ 3U * i ] );
+        low = HexValue( pHex[ ( 3U * i ) + 1U ] );
+
+        if( ( high == SDP_HEX_INVALID ) ||
+            ( low == SDP_HEX_INVALID ) ||
+            ( ( ( i + 1U ) < pFingerprint->digestLength ) && ( pHex[ ( 3U * i ) + 2U ] != ':' ) ) )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT;
+        }
+        else
+        {
+            pFingerprint->digest[ i ] = ( uint8_t ) ( ( high << 4 ) | low );
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_CompareFingerprint( const SdpFingerprint_t * pFingerprint,
+                                                const uint8_t * pDigest,
+                                                size_t digestLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    uint8_t difference = 0;
+    size_t i;
+
+    /* Input check. */
+    if( ( pFingerprint == NULL ) ||
+        ( pDigest == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else if( digestLength != pFingerprint->digestLength )
+    {
+        /* The digest length is public, only the bytes must not leak. */
+        result = SDP_RESULT_FINGERPRINT_MISMATCH;
+    }
+    else
+    {
+        /* Visit every byte so the time does not depend on where the digests
+         * differ. */
+        for( i = 0; i < digestLength; i++ )
+        {
+            difference |= ( uint8_t ) ( pFingerprint->digest[ i ] ^ pDigest[ i ] );
+        }
+
+        if( difference != 0U )
+        {
+            result = SDP_RESULT_FINGERPRINT_MISMATCH;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseRtcpFeedback( const SdpAttribute_t * pAttribute,
+                                               SdpRtcpFeedback_t * pRtcpFeedback )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, end, tokenLength = 0;
+    const char * pToken = NULL;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pRtcpFeedback == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = CheckAttribute( pAttribute, "rtcp-fb", 7U );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pRtcpFeedback, 0, sizeof( SdpRtcpFeedback_t ) );
+
+        /* <payload type or "*"> SP <type> [SP <parameter>] */
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else if( TokenEquals( pToken, tokenLength, "*", 1U ) != 0 )
+        {
+            pRtcpFeedback->allPayloadTypes = 1;
+        }
+        else if( ParseUnsignedInteger( pToken, tokenLength, SDP_RTP_PAYLOAD_TYPE_MAX, &( parsedValue ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            pRtcpFeedback->payloadType = ( uint8_t ) parsedValue;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pRtcpFeedback->pType ), &( pRtcpFeedback->typeLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            end = pAttribute->attributeValueLength;
+            TrimSpaces( pAttribute->pAttributeValue, &( offset ), &( end ) );
+
+            if( offset != end )
+            {
+                pRtcpFeedback->pParameter = &( pAttribute->pAttributeValue[ offset ] );
+                pRtcpFeedback->parameterLength = end - offset;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_MESSAGE_MALFORMED )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTCP_FB;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseExtMap( const SdpAttribute_t * pAttribute,
+                                         SdpExtMap_t * pExtMap )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, end, tokenLength = 0, idLength;
+    const char * pToken = NULL;
+    const char * pSlash = NULL;
+    const char * pDirection;
+    size_t directionLength;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pExtMap == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
+    else
+    {
+        result = CheckAttribute( pAttribute, "extmap", 6U );
+    }
 
     if( result == SDP_RESULT_OK )
     {
-        pCtx->pStart = pSdpMessage;
-        pCtx->totalLength = sdpMessageLength;
-        pCtx->currentIndex = 0;
+        ( void ) memset( pExtMap, 0, sizeof( SdpExtMap_t ) );
+
+        /* <id>["/"<direction>] SP <URI> [SP <extension attributes>] */
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            pSlash = memchr( pToken, '/', tokenLength );
+            idLength = ( pSlash == NULL ) ? tokenLength : ( size_t ) ( pSlash - pToken );
+
+            if( ( ParseUnsignedInteger( pToken, idLength, UINT16_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) ||
+                ( parsedValue == 0U ) )
+            {
+                result = SDP_RESULT_MESSAGE_MALFORMED;
+            }
+            else
+            {
+                pExtMap->id = ( uint16_t ) parsedValue;
+            }
+        }
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( pSlash != NULL ) )
+    {
+        pDirection = pSlash + 1;
+        directionLength = tokenLength - ( size_t ) ( pDirection - pToken );
+
+        if( TokenEquals( pDirection, directionLength, "sendrecv", 8U ) != 0 )
+        {
+            pExtMap->direction = SDP_EXTMAP_DIRECTION_SENDRECV;
+        }
+        else if( TokenEquals( pDirection, directionLength, "sendonly", 8U ) != 0 )
+        {
+            pExtMap->direction = SDP_EXTMAP_DIRECTION_SENDONLY;
+        }
+        else if( TokenEquals( pDirection, directionLength, "recvonly", 8U ) != 0 )
+        {
+            pExtMap->direction = SDP_EXTMAP_DIRECTION_RECVONLY;
+        }
+        else if( TokenEquals( pDirection, directionLength, "inactive", 8U ) != 0 )
+        {
+            pExtMap->direction = SDP_EXTMAP_DIRECTION_INACTIVE;
+        }
+        else
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pExtMap->pUri ), &( pExtMap->uriLength ) ) != SDP_RESULT_OK )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            end = pAttribute->attributeValueLength;
+            TrimSpaces( pAttribute->pAttributeValue, &( offset ), &( end ) );
+
+            if( offset != end )
+            {
+                pExtMap->pExtensionAttributes = &( pAttribute->pAttributeValue[ offset ] );
+                pExtMap->extensionAttributesLength = end - offset;
+            }
+        }
+    }
+
+    if( result == SDP_RESULT_MESSAGE_MALFORMED )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_EXTMAP;
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_GetNext( SdpDeserializerContext_t * pCtx,
-                                     uint8_t * pType,
-                                     const char ** pValue,
-                                     size_t * pValueLength )
+SdpResult_t SdpDeserializer_ParseSsrc( const SdpAttribute_t * pAttribute,
+                                       SdpSsrc_t * pSsrc )
 {
-    size_t i, remainingLength, valueLength;
     SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, end, tokenLength = 0;
+    const char * pToken = NULL;
+    const char * pColon;
+    uint64_t parsedValue;
 
-    if( ( pCtx == NULL ) ||
-        ( pType == NULL ) ||
-        ( pValue == NULL ) ||
-        ( pValueLength == NULL ) )
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pSsrc == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
+    else
+    {
+        result = CheckAttribute( pAttribute, "ssrc", 4U );
+    }
 
     if( result == SDP_RESULT_OK )
     {
-        if( pCtx->currentIndex == pCtx->totalLength )
+        ( void ) memset( pSsrc, 0, sizeof( SdpSsrc_t ) );
+
+        /* <ssrc-id> SP <attribute>[":"<value>] */
+        if( ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) != SDP_RESULT_OK ) ||
+            ( ParseUnsignedInteger( pToken, tokenLength, UINT32_MAX, &( parsedValue ) ) != SDP_RESULT_OK ) )
         {
-            result = SDP_RESULT_MESSAGE_END;
+            result = SDP_RESULT_MESSAGE_MALFORMED;
+        }
+        else
+        {
+            pSsrc->ssrc = ( uint32_t ) parsedValue;
         }
     }
 
     if( result == SDP_RESULT_OK )
     {
-        remainingLength = pCtx->totalLength - pCtx->currentIndex;
+        end = pAttribute->attributeValueLength;
+        TrimSpaces( pAttribute->pAttributeValue, &( offset ), &( end ) );
+        pColon = memchr( &( pAttribute->pAttributeValue[ offset ] ), ':', end - offset );
+
+        pSsrc->pAttributeName = &( pAttribute->pAttributeValue[ offset ] );
 
-        if( remainingLength < 3 )
+        if( pColon == NULL )
         {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+            pSsrc->attributeNameLength = end - offset;
+        }
+        else
+        {
+            pSsrc->attributeNameLength = ( size_t ) ( pColon - pSsrc->pAttributeName );
+            pSsrc->pAttributeValue = pColon + 1;
+            pSsrc->attributeValueLength = ( end - offset ) - ( pSsrc->attributeNameLength + 1U );
+        }
+
+        if( pSsrc->attributeNameLength == 0U )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED;
         }
     }
 
+    if( result == SDP_RESULT_MESSAGE_MALFORMED )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_SSRC;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpDeserializer_ParseSsrcGroup( const SdpAttribute_t * pAttribute,
+                                            SdpSsrcGroup_t * pSsrcGroup )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t offset = 0, tokenLength = 0;
+    const char * pToken = NULL;
+    uint64_t parsedValue;
+
+    /* Input check. */
+    if( ( pAttribute == NULL ) ||
+        ( pSsrcGroup == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = CheckAttribute( pAttribute, "ssrc-group", 10U );
+    }
+
     if( result == SDP_RESULT_OK )
     {
-        if( pCtx->pStart[ pCtx->currentIndex + 1 ] != '=' )
+        ( void ) memset( pSsrcGroup, 0, sizeof( SdpSsrcGroup_t ) );
+
+        /* <semantics> *(SP <ssrc-id>) */
+        if( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pSsrcGroup->pSemantics ), &( pSsrcGroup->semanticsLength ) ) != SDP_RESULT_OK )
         {
-            result = SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND;
+            result = SDP_RESULT_MESSAGE_MALFORMED;
         }
     }
 
-    if( result == SDP_RESULT_OK )
+    while( ( result == SDP_RESULT_OK ) &&
+           ( NextToken( pAttribute->pAttributeValue, pAttribute->attributeValueLength, &( offset ), &( pToken ), &( tokenLength ) ) == SDP_RESULT_OK ) )
     {
-        for( i = pCtx->currentIndex + 2; i < pCtx->totalLength; i++ )
+        if( ParseUnsignedInteger( pToken, tokenLength, UINT32_MAX, &( parsedValue ) ) != SDP_RESULT_OK )
         {
-            if( pCtx->pStart[ i ] == '\n' )
-            {
-                break;
-            }
+            result = SDP_RESULT_MESSAGE_MALFORMED;
         }
-
-        if( i == pCtx->totalLength )
+        else if( pSsrcGroup->ssrcCount == SDP_SSRC_GROUP_MAX_SSRCS )
         {
-            /* No '\n' found. */
-            result = SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND;
+            result = SDP_RESULT_OUT_OF_MEMORY;
         }
-
-        if( result == SDP_RESULT_OK )
+        else
         {
-            if( pCtx->pStart[ i - 1 ] == '\r' )
-            {
-                valueLength = i - pCtx->currentIndex - 3;
-            }
-            else
-            {
-                valueLength = i - pCtx->currentIndex - 2;
-            }
-
-            if( valueLength > 0 )
-            {
-                *pType = pCtx->pStart[ pCtx->currentIndex ];
-                *pValue = &( pCtx->pStart[ pCtx->currentIndex + 2 ] );
-                *pValueLength = valueLength;
-                pCtx->currentIndex = pCtx->currentIndex + ( i - pCtx->currentIndex ) + 1;
-            }
-            else
-            {
-                result = SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE;
-            }
+            pSsrcGroup->ssrcs[ pSsrcGroup->ssrcCount ] = ( uint32_t ) parsedValue;
+            pSsrcGroup->ssrcCount++;
         }
     }
 
+    if( ( result == SDP_RESULT_OK ) && ( pSsrcGroup->ssrcCount == 0U ) )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED;
+    }
+
+    if( result == SDP_RESULT_MESSAGE_MALFORMED )
+    {
+        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_SSRC;
+    }
+
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_ParseOriginator( const char * pValue,
-                                             size_t valueLength,
-                                             SdpOriginator_t * pOriginator )
+SdpResult_t SdpDeserializer_ParseSession( SdpDeserializerContext_t * pCtx,
+                                          const SdpSessionStorage_t * pStorage,
+                                          SdpSessionDescription_t * pSession )
 {
     SdpResult_t result = SDP_RESULT_OK;
-    size_t i, start = 0, numSpaces = 0;
-    int sscanfRetVal;
+    SdpMediaDescription_t * pMediaDescription = NULL;
+    size_t * pConnectionInfoCount, * pBandwidthInfoCount, * pAttributeCount;
+    size_t connectionInfosUsed = 0, bandwidthInfosUsed = 0, attributesUsed = 0;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+    uint64_t version;
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pOriginator == NULL ) )
+    if( ( pCtx == NULL ) ||
+        ( pStorage == NULL ) ||
+        ( pSession == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
 
     if( result == SDP_RESULT_OK )
     {
-        for( i = 0; i < valueLength; i++ )
+        ( void ) memset( pSession, 0, sizeof( SdpSessionDescription_t ) );
+        pSession->pConnectionInfos = pStorage->pConnectionInfos;
+        pSession->pBandwidthInfos = pStorage->pBandwidthInfos;
+        pSession->pTimeDescriptions = pStorage->pTimeDescriptions;
+        pSession->pAttributes = pStorage->pAttributes;
+        pSession->pMediaDescriptions = pStorage->pMediaDescriptions;
+
+        /* Lines before the first "m=" belong to the session. */
+        pConnectionInfoCount = &( pSession->connectionInfoCount );
+        pBandwidthInfoCount = &( pSession->bandwidthInfoCount );
+        pAttributeCount = &( pSession->attributeCount );
+    }
+
+    while( result == SDP_RESULT_OK )
+    {
+        result = SdpDeserializer_GetNext( pCtx, &( type ), &( pValue ), &( valueLength ) );
+
+        if( result != SDP_RESULT_OK )
         {
-            if( pValue[ i ] == ' ' )
-            {
-                numSpaces += 1;
+            break;
+        }
 
-                if( numSpaces == 1 )
+        switch( type )
+        {
+            case SDP_TYPE_VERSION:
+            case SDP_TYPE_ORIGINATOR:
+            case SDP_TYPE_SESSION_NAME:
+            case SDP_TYPE_TIME_ACTIVE:
+
+                if( pMediaDescription != NULL )
                 {
-                    pOriginator->pUserName = &( pValue[ start ] );
-                    pOriginator->userNameLength = i - start;
+                    /* Session-level line inside a media description. */
+                    result = SDP_RESULT_MESSAGE_MALFORMED;
                 }
-                else if( numSpaces == 2 )
+                else if( type == SDP_TYPE_VERSION )
                 {
-                    sscanfRetVal = sscanf( &( pValue[ start ] ),
-                                           "%" SDP_PRINT_FMT_UINT64,
-                                           &( pOriginator->sessionId ) );
-
-                    if( sscanfRetVal != 1 )
+                    if( ParseUnsignedInteger( pValue, valueLength, UINT32_MAX, &( version ) ) != SDP_RESULT_OK )
                     {
-                        result = SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_ID;
-                        break;
+                        result = SDP_RESULT_MESSAGE_MALFORMED;
+                    }
+                    else
+                    {
+                        pSession->version = ( uint32_t ) version;
                     }
                 }
-                else /* numSpaces == 3 */
+                else if( type == SDP_TYPE_ORIGINATOR )
                 {
-                    sscanfRetVal = sscanf( &( pValue[ start ] ),
-                                           "%" SDP_PRINT_FMT_UINT64,
-                                           &( pOriginator->sessionVersion ) );
-
-                    if( sscanfRetVal != 1 )
+                    result = SdpDeserializer_ParseOriginator( pValue, valueLength, &( pSession->originator ) );
+                }
+                else if( type == SDP_TYPE_SESSION_NAME )
+                {
+                    pSession->pSessionName = pValue;
+                    pSession->sessionNameLength = valueLength;
+                }
+                else /* SDP_TYPE_TIME_ACTIVE */
+                {
+                    if( pSession->timeDescriptionCount == pStorage->timeDescriptionsLength )
                     {
-                        result = SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION;
-                        break;
+                        result = SDP_RESULT_OUT_OF_MEMORY;
                     }
                     else
                     {
-                        /* Skip over space. */
-                        start = i + 1;
-
-                        /* break to parse connection info inside of originator. */
-                        break;
+                        result = SdpDeserializer_ParseTimeActive( pValue,
+                                                                  valueLength,
+                                                                  &( pSession->pTimeDescriptions[ pSession->timeDescriptionCount ] ) );
+                        pSession->timeDescriptionCount++;
                     }
                 }
 
-                start = i + 1;
-            }
-        }
-    }
+                break;
 
-    if( result == SDP_RESULT_OK )
-    {
-        if( i < valueLength )
-        {
-            /* Originator part is parsed, continue to parse connection info. */
-            result = SdpDeserializer_ParseConnectionInfo( &( pValue[ start ] ),
-                                                          valueLength - start,
-                                                          &( pOriginator->connectionInfo ) );
-        }
-        else
-        {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+            case SDP_TYPE_SESSION_INFO:
+
+                /* "i=" is the session information before the first "m=" and
+                 * the media title after it. */
+                if( pMediaDescription != NULL )
+                {
+                    pMediaDescription->pMediaTitle = pValue;
+                    pMediaDescription->mediaTitleLength = valueLength;
+                }
+                else
+                {
+                    pSession->pSessionInfo = pValue;
+                    pSession->sessionInfoLength = valueLength;
+                }
+
+                break;
+
+            case SDP_TYPE_CONNINFO:
+
+                if( connectionInfosUsed == pStorage->connectionInfosLength )
+                {
+                    result = SDP_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    result = SdpDeserializer_ParseConnectionInfo( pValue,
+                                                                  valueLength,
+                                                                  &( pStorage->pConnectionInfos[ connectionInfosUsed ] ) );
+                    connectionInfosUsed++;
+                    ( *pConnectionInfoCount )++;
+                }
+
+                break;
+
+            case SDP_TYPE_BANDWIDTH:
+
+                if( bandwidthInfosUsed == pStorage->bandwidthInfosLength )
+                {
+                    result = SDP_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    result = SdpDeserializer_ParseBandwidthInfo( pValue,
+                                                                 valueLength,
+                                                                 &( pStorage->pBandwidthInfos[ bandwidthInfosUsed ] ) );
+                    bandwidthInfosUsed++;
+                    ( *pBandwidthInfoCount )++;
+                }
+
+                break;
+
+            case SDP_TYPE_ATTRIBUTE:
+
+                if( attributesUsed == pStorage->attributesLength )
+                {
+                    result = SDP_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    result = SdpDeserializer_ParseAttribute( pValue,
+                                                             valueLength,
+                                                             &( pStorage->pAttributes[ attributesUsed ] ) );
+                    attributesUsed++;
+                    ( *pAttributeCount )++;
+                }
+
+                break;
+
+            case SDP_TYPE_MEDIA:
+
+                if( pSession->mediaDescriptionCount == pStorage->mediaDescriptionsLength )
+                {
+                    result = SDP_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    pMediaDescription = &( pSession->pMediaDescriptions[ pSession->mediaDescriptionCount ] );
+                    pSession->mediaDescriptionCount++;
+
+                    ( void ) memset( pMediaDescription, 0, sizeof( SdpMediaDescription_t ) );
+                    pMediaDescription->pConnectionInfos = &( pStorage->pConnectionInfos[ connectionInfosUsed ] );
+                    pMediaDescription->pBandwidthInfos = &( pStorage->pBandwidthInfos[ bandwidthInfosUsed ] );
+                    pMediaDescription->pAttributes = &( pStorage->pAttributes[ attributesUsed ] );
+
+                    pConnectionInfoCount = &( pMediaDescription->connectionInfoCount );
+                    pBandwidthInfoCount = &( pMediaDescription->bandwidthInfoCount );
+                    pAttributeCount = &( pMediaDescription->attributeCount );
+
+                    result = SdpDeserializer_ParseMedia( pValue, valueLength, &( pMediaDescription->media ) );
+                }
+
+                break;
+
+            default:
+                /* Lines that are not part of the session description. */
+                break;
         }
     }
 
+    if( result == SDP_RESULT_MESSAGE_END )
+    {
+        result = SDP_RESULT_OK;
+    }
+
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_ParseConnectionInfo( const char * pValue,
-                                                 size_t valueLength,
-                                                 SdpConnectionInfo_t * pConnInfo )
+SdpResult_t SdpDeserializer_ParseSessionWithArena( SdpDeserializerContext_t * pCtx,
+                                                   SdpArena_t * pArena,
+                                                   SdpSessionDescription_t * pSession )
 {
     SdpResult_t result = SDP_RESULT_OK;
-    size_t i, start = 0, numSpaces = 0;
+    SdpDeserializerContext_t countCtx;
+    SdpSessionStorage_t storage;
+    void * pMemory;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pConnInfo == NULL ) )
+    if( ( pCtx == NULL ) ||
+        ( pArena == NULL ) ||
+        ( pSession == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
 
     if( result == SDP_RESULT_OK )
     {
-        for( i = 0; i < valueLength; i++ )
+        ( void ) memset( &( storage ), 0, sizeof( SdpSessionStorage_t ) );
+
+        /* Count the entries on a copy of the context so that the parse below
+         * starts from the same position. */
+        countCtx = *pCtx;
+
+        while( result == SDP_RESULT_OK )
         {
-            if( pValue[ i ] == ' ' )
-            {
-                numSpaces += 1;
+            result = SdpDeserializer_GetNext( &( countCtx ), &( type ), &( pValue ), &( valueLength ) );
 
-                if( numSpaces == 1 )
+            if( result == SDP_RESULT_OK )
+            {
+                if( type == SDP_TYPE_MEDIA )
                 {
-                    if( ( i - start ) == 2 )
-                    {
-                        if( strncmp( &( pValue[ start ] ), "IN", 2 ) == 0 )
-                        {
-                            pConnInfo->networkType = SDP_NETWORK_IN;
-                        }
-                        else
-                        {
-                            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_NETWORK_TYPE;
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_NETWORK_TYPE;
-                        break;
-                    }
+                    storage.mediaDescriptionsLength++;
                 }
-                else if( numSpaces == 2 )
+                else if( type == SDP_TYPE_ATTRIBUTE )
                 {
-                    if( ( i - start ) == 3 )
-                    {
-                        if( strncmp( &( pValue[ start ] ), "IP4", 3 ) == 0 )
-                        {
-                            pConnInfo->addressType = SDP_ADDRESS_IPV4;
-                        }
-                        else if( strncmp( &( pValue[ start ] ), "IP6", 3 ) == 0 )
-                        {
-                            pConnInfo->addressType = SDP_ADDRESS_IPV6;
-                        }
-                        else
-                        {
-                            result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_ADDRESS_TYPE;
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_ADDRESS_TYPE;
-                        break;
-                    }
+                    storage.attributesLength++;
+                }
+                else if( type == SDP_TYPE_CONNINFO )
+                {
+                    storage.connectionInfosLength++;
+                }
+                else if( type == SDP_TYPE_BANDWIDTH )
+                {
+                    storage.bandwidthInfosLength++;
+                }
+                else if( type == SDP_TYPE_TIME_ACTIVE )
+                {
+                    storage.timeDescriptionsLength++;
                 }
                 else
                 {
-                    result = SDP_RESULT_MESSAGE_MALFORMED_REDUNDANT_INFO;
+                    /* Not stored in an array. */
                 }
-
-                start = i + 1;
             }
         }
-    }
 
-    if( result == SDP_RESULT_OK )
-    {
-        if( numSpaces == 2 )
-        {
-            pConnInfo->pAddress = &( pValue[ start ] );
-            pConnInfo->addressLength = i - start;
-        }
-        else
+        if( result == SDP_RESULT_MESSAGE_END )
         {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+            result = SDP_RESULT_OK;
         }
     }
 
-    return result;
-}
-/*-----------------------------------------------------------*/
-
-SdpResult_t SdpDeserializer_ParseBandwidthInfo( const char * pValue,
-                                                size_t valueLength,
-                                                SdpBandwidthInfo_t * pBandwidthInfo )
-{
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t i, numColon = 0;
-    int sscanfRetVal;
+    if( ( result == SDP_RESULT_OK ) && ( storage.mediaDescriptionsLength > 0U ) )
+    {
+        result = SdpArena_Allocate( pArena, storage.mediaDescriptionsLength * sizeof( SdpMediaDescription_t ), &( pMemory ) );
+        storage.pMediaDescriptions = ( SdpMediaDescription_t * ) pMemory;
+    }
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pBandwidthInfo == NULL ) )
+    if( ( result == SDP_RESULT_OK ) && ( storage.attributesLength > 0U ) )
     {
-        result = SDP_RESULT_BAD_PARAM;
+        result = SdpArena_Allocate( pArena, storage.attributesLength * sizeof( SdpAttribute_t ), &( pMemory ) );
+        storage.pAttributes = ( SdpAttribute_t * ) pMemory;
     }
 
-    if( result == SDP_RESULT_OK )
+    if( ( result == SDP_RESULT_OK ) && ( storage.connectionInfosLength > 0U ) )
     {
-        for( i = 0; i < valueLength; i++ )
-        {
-            if( pValue[ i ] == ':' )
-            {
-                numColon += 1;
-                pBandwidthInfo->pBwType = &( pValue[ 0 ] );
-                pBandwidthInfo->bwTypeLength = i;
+        result = SdpArena_Allocate( pArena, storage.connectionInfosLength * sizeof( SdpConnectionInfo_t ), &( pMemory ) );
+        storage.pConnectionInfos = ( SdpConnectionInfo_t * ) pMemory;
+    }
 
-                sscanfRetVal = sscanf( &( pValue[ i + 1 ] ),
-                                       "%" SDP_PRINT_FMT_UINT64,
-                                       &( pBandwidthInfo->sdpBandwidthValue ) );
-                if( sscanfRetVal != 1 )
-                {
-                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_BANDWIDTH;
-                }
+    if( ( result == SDP_RESULT_OK ) && ( storage.bandwidthInfosLength > 0U ) )
+    {
+        result = SdpArena_Allocate( pArena, storage.bandwidthInfosLength * sizeof( SdpBandwidthInfo_t ), &( pMemory ) );
+        storage.pBandwidthInfos = ( SdpBandwidthInfo_t * ) pMemory;
+    }
 
-                break;
-            }
-        }
+    if( ( result == SDP_RESULT_OK ) && ( storage.timeDescriptionsLength > 0U ) )
+    {
+        result = SdpArena_Allocate( pArena, storage.timeDescriptionsLength * sizeof( SdpTimeDescription_t ), &( pMemory ) );
+        storage.pTimeDescriptions = ( SdpTimeDescription_t * ) pMemory;
+    }
 
-        if( numColon == 0 )
-        {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
-        }
+    if( result == SDP_RESULT_OK )
+    {
+        result = SdpDeserializer_ParseSession( pCtx, &( storage ), pSession );
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_ParseTimeActive( const char * pValue,
-                                             size_t valueLength,
-                                             SdpTimeDescription_t * pTimeDescription )
+SdpResult_t SdpDeserializer_Walk( SdpDeserializerContext_t * pCtx,
+                                  const SdpVisitor_t * pVisitor,
+                                  void * pUserContext )
 {
     SdpResult_t result = SDP_RESULT_OK;
-    size_t i, numSpaces = 0;
-    int sscanfRetVal;
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pTimeDescription == NULL ) )
+    if( ( pCtx == NULL ) ||
+        ( pVisitor == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
-
-    if( result == SDP_RESULT_OK )
+    else
     {
-        for( i = 0; i < valueLength; i++ )
-        {
-            if( pValue[ i ] == ' ' )
-            {
-                numSpaces += 1;
-
-                /* Parse start-time. */
-                sscanfRetVal = sscanf( &( pValue[ 0 ] ),
-                                       "%" SDP_PRINT_FMT_UINT64,
-                                       &( pTimeDescription->startTime ) );
-
-                if( sscanfRetVal != 1 )
-                {
-                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_START_TIME;
-                    break;
-                }
-
-                /* Parse stop-time. */
-                sscanfRetVal = sscanf( &( pValue[ i + 1 ] ),
-                                       "%" SDP_PRINT_FMT_UINT64,
-                                       &( pTimeDescription->stopTime ) );
-
-                if( sscanfRetVal != 1 )
-                {
-                    result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_STOP_TIME;
-                }
-
-                break;
-            }
-        }
-
-        if( numSpaces == 0 )
-        {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
-        }
+        result = WalkLines( pCtx, pVisitor, pUserContext, NULL );
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_ParseAttribute( const char * pValue,
-                                            size_t valueLength,
-                                            SdpAttribute_t * pAttribute )
+SdpResult_t SdpDeserializer_WalkSelected( SdpDeserializerContext_t * pCtx,
+                                          const SdpVisitor_t * pVisitor,
+                                          void * pUserContext,
+                                          const SdpParseMask_t * pMask )
 {
     SdpResult_t result = SDP_RESULT_OK;
-    size_t i;
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pAttribute == NULL ) )
+    if( ( pCtx == NULL ) ||
+        ( pVisitor == NULL ) ||
+        ( pMask == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
-
-    if( result == SDP_RESULT_OK )
+    else
     {
-        for( i = 0; i < valueLength; i++ )
-        {
-            if( pValue[ i ] == ':' )
-            {
-                pAttribute->pAttributeName = &( pValue[ 0 ] );
-                pAttribute->attributeNameLength = i;
-
-                pAttribute->pAttributeValue = &( pValue[ i + 1 ] );
-                pAttribute->attributeValueLength = valueLength - ( i + 1 );
-                break;
-            }
-        }
-
-        /* No ':' in this attribute. */
-        if( i == valueLength )
-        {
-            pAttribute->pAttributeName = &( pValue[ 0 ] );
-            pAttribute->attributeNameLength = valueLength;
-
-            pAttribute->pAttributeValue = NULL;
-            pAttribute->attributeValueLength = 0;
-        }
+        result = WalkLines( pCtx, pVisitor, pUserContext, pMask );
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpDeserializer_ParseMedia( const char * pValue,
-                                        size_t valueLength,
-                                        SdpMedia_t * pMedia )
+SdpResult_t SdpDeserializer_ParseBatch( SdpBatchSlot_t * pSlots,
+                                        size_t slotCount,
+                                        size_t workerIndex,
+                                        size_t workerCount )
 {
     SdpResult_t result = SDP_RESULT_OK;
-    size_t i, j, start = 0, numSpaces = 0;
-    int sscanfRetVal;
+    SdpDeserializerContext_t ctx;
+    SdpBatchSlot_t * pSlot;
+    size_t i;
 
-    /* Input check. */
-    if( ( pValue == NULL ) ||
-        ( pMedia == NULL ) )
+    if( ( ( pSlots == NULL ) && ( slotCount > 0U ) ) ||
+        ( workerCount == 0U ) ||
+        ( workerIndex >= workerCount ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
 
     if( result == SDP_RESULT_OK )
     {
-        for( i = 0; i < valueLength; i++ )
-        {
-            if( pValue[ i ] == ' ' )
-            {
-                numSpaces += 1;
-
-                if( numSpaces == 1 )
-                {
-                    pMedia->pMedia = &( pValue[ start ] );
-                    pMedia->mediaLength = i - start;
-                }
-                else if( numSpaces == 2 )
-                {
-                    sscanfRetVal = sscanf( &( pValue[ start ] ),
-                                           "%" SDP_PRINT_FMT_UINT16,
-                                           &( pMedia->port ) );
-
-                    if( sscanfRetVal != 1 )
-                    {
-                        result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORT;
-                        break;
-                    }
-
-                    pMedia->portNum = 0;
-
-                    for( j = start ; j < i ; j++ )
-                    {
-                        if( pValue[ j ] == '/' )
-                        {
-                            sscanfRetVal = sscanf( &( pValue[ j + 1 ] ),
-                                                   "%" SDP_PRINT_FMT_UINT16,
-                                                   &( pMedia->portNum ) );
-
-                            if( sscanfRetVal != 1 )
-                            {
-                                result = SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORTNUM;
-                            }
-
-                            break;
-                        }
-                    }
-                }
-                else /* numSpaces == 3 */
-                {
-                    pMedia->pProtocol = &( pValue[ start ] );
-                    pMedia->protocolLength = i - start;
+        /* Interleave the slots so that a run of large messages is spread over
+         * all workers. */
+        i = workerIndex;
 
-                    /* Skip last ' ' in protocol. */
-                    start = i + 1;
-                    break;
-                }
+        while( i < slotCount )
+        {
+            pSlot = &( pSlots[ i ] );
+            pSlot->result = SdpDeserializer_Init( &( ctx ), pSlot->pMessage, pSlot->messageLength );
 
-                start = i + 1;
+            if( pSlot->result == SDP_RESULT_OK )
+            {
+                pSlot->result = SdpDeserializer_ParseSessionWithArena( &( ctx ), pSlot->pArena, &( pSlot->session ) );
             }
-        }
-    }
 
-    if( result == SDP_RESULT_OK )
-    {
-        if( i < valueLength )
-        {
-            pMedia->pFmt = &( pValue[ start ] );
-            pMedia->fmtLength = valueLength - start;
-        }
-        else
-        {
-            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+            /* Stop without computing i + workerCount when it could wrap
+             * around. */
+            i = ( ( slotCount - i ) > workerCount ) ? ( i + workerCount ) : slotCount;
         }
     }
 
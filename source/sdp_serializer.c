@@ -1,10 +1,465 @@
 /* Standard includes. */
-#include <stdio.h>
 #include <string.h>
 
 /* Interface includes. */
 #include "sdp_serializer.h"
 
+/**
+ * @brief Maximum number of decimal digits in a uint64_t.
+ */
+#define SDP_MAX_UINT64_DIGITS    ( 20 )
+
+/**
+ * @brief Length of "<type>=" and "\r\n" around every value.
+ */
+#define SDP_LINE_OVERHEAD        ( 4U )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A piece of a line that is copied verbatim into the output.
+ */
+typedef struct SdpLineSegment
+{
+    const char * pData;
+    size_t length;
+    uint8_t isCallerData; /* Referenced instead of copied by the gather mode. */
+} SdpLineSegment_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Powers of 10 used to count decimal digits.
+ */
+static const uint64_t powersOfTen[ SDP_MAX_UINT64_DIGITS ] =
+{
+    1ULL,                    10ULL,                   100ULL,
+    1000ULL,                 10000ULL,                100000ULL,
+    1000000ULL,              10000000ULL,             100000000ULL,
+    1000000000ULL,           10000000000ULL,          100000000000ULL,
+    1000000000000ULL,        10000000000000ULL,       100000000000000ULL,
+    1000000000000000ULL,     10000000000000000ULL,    100000000000000000ULL,
+    1000000000000000000ULL,  10000000000000000000ULL
+};
+
+/**
+ * @brief Decimal representation of every number from 00 to 99.
+ */
+static const char twoDigits[ 201 ] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Count the decimal digits of a value.
+ *
+ * @param[in] value The value.
+ *
+ * @return Number of digits, at least 1.
+ */
+static size_t CountDigits( uint64_t value );
+
+/**
+ * @brief Write the decimal representation of a value.
+ *
+ * @param[out] pBuffer Buffer of at least SDP_MAX_UINT64_DIGITS bytes.
+ * @param[in] value The value.
+ *
+ * @return Number of characters written.
+ */
+static size_t FormatUnsignedInteger( char * pBuffer,
+                                     uint64_t value );
+
+/**
+ * @brief Length of a string bounded by maxLength, stopping at the first NULL
+ * character in the same way as a "%.*s" conversion. When SDP_TRUSTED_INPUT is
+ * set, maxLength is returned without looking for a NULL character.
+ *
+ * @param[in] pString The string.
+ * @param[in] maxLength Maximum length of the string.
+ *
+ * @return Length of the string.
+ */
+static size_t BoundedLength( const char * pString,
+                             size_t maxLength );
+
+/**
+ * @brief Append "<type>=<segments>\r\n" to the output.
+ *
+ * When the context has no buffer and no grow callback, only the length of the
+ * line is accumulated. A full buffer is grown if the context has a grow
+ * callback.
+ *
+ * @param[in] pCtx The serializer context.
+ * @param[in] type The SDP type.
+ * @param[in] pSegments The pieces of the value.
+ * @param[in] segmentCount Number of pieces.
+ *
+ * @return SDP_RESULT_OK if the line is appended, SDP_RESULT_OUT_OF_MEMORY if
+ * it does not fit in the buffer.
+ */
+static SdpResult_t AppendLine( SdpSerializerContext_t * pCtx,
+                               uint8_t type,
+                               const SdpLineSegment_t * pSegments,
+                               size_t segmentCount );
+
+/**
+ * @brief Append "<type>=<segments>\r\n" to the pieces of a gather context.
+ *
+ * Segments of the caller become pieces of their own, everything else is
+ * copied into the scratch buffer. Nothing is appended if the line does not
+ * fit.
+ *
+ * @param[in] pCtx The serializer context.
+ * @param[in] type The SDP type.
+ * @param[in] pSegments The pieces of the value.
+ * @param[in] segmentCount Number of pieces.
+ * @param[in] lineLength Length of the whole line.
+ *
+ * @return SDP_RESULT_OK if the line is appended, SDP_RESULT_OUT_OF_MEMORY if
+ * it does not fit in the scratch buffer or in the pieces.
+ */
+static SdpResult_t GatherLine( SdpSerializerContext_t * pCtx,
+                               uint8_t type,
+                               const SdpLineSegment_t * pSegments,
+                               size_t segmentCount,
+                               size_t lineLength );
+
+/**
+ * @brief Copy data to the scratch buffer of a gather context, extending the
+ * last piece when it ends where the copy starts.
+ *
+ * The caller checks that the scratch buffer and the pieces have room.
+ *
+ * @param[in] pCtx The serializer context.
+ * @param[in] pData The data.
+ * @param[in] length Length of the data.
+ */
+static void GatherCopy( SdpSerializerContext_t * pCtx,
+                        const char * pData,
+                        size_t length );
+
+/**
+ * @brief Rewrite the session version of the "o=" line of a serialized
+ * message.
+ *
+ * @param[in,out] pBuffer The message.
+ * @param[in] bufferLength Size of the buffer holding the message.
+ * @param[in,out] pMessageLength Length of the message.
+ * @param[in] increment Non-zero to write the current version plus one.
+ * @param[in] sessionVersion The version to write when increment is 0.
+ * @param[in] minimumDigits Minimum width of the version, on top of the
+ * width of the current field.
+ * @param[out] pSessionVersion The version written, or NULL.
+ *
+ * @return SDP_RESULT_OK on success, SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO
+ * if there is no "o=" line, SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION if
+ * its version is not a number, SDP_RESULT_OUT_OF_MEMORY if the wider version
+ * does not fit in the buffer.
+ */
+static SdpResult_t RewriteSessionVersion( char * pBuffer,
+                                          size_t bufferLength,
+                                          size_t * pMessageLength,
+                                          uint8_t increment,
+                                          uint64_t sessionVersion,
+                                          size_t minimumDigits,
+                                          uint64_t * pSessionVersion );
+
+/**
+ * @brief Grow the output buffer with the grow callback of the context to at
+ * least twice its size, and at least requiredLength bytes.
+ *
+ * @param[in] pCtx The serializer context.
+ * @param[in] requiredLength The buffer length needed.
+ *
+ * @return SDP_RESULT_OK, or SDP_RESULT_OUT_OF_MEMORY if the callback fails.
+ */
+static SdpResult_t GrowBuffer( SdpSerializerContext_t * pCtx,
+                               size_t requiredLength );
+
+/*-----------------------------------------------------------*/
+
+static size_t CountDigits( uint64_t value )
+{
+    size_t digits = 1;
+
+    while( ( digits < SDP_MAX_UINT64_DIGITS ) && ( value >= powersOfTen[ digits ] ) )
+    {
+        digits++;
+    }
+
+    return digits;
+}
+/*-----------------------------------------------------------*/
+
+static size_t FormatUnsignedInteger( char * pBuffer,
+                                     uint64_t value )
+{
+    size_t digits = CountDigits( value );
+    size_t i = digits;
+    size_t pair;
+
+    /* Write two digits at a time from the least significant end. */
+    while( value >= 100U )
+    {
+        pair = ( size_t ) ( value % 100U ) * 2U;
+        value /= 100U;
+        i -= 2U;
+        pBuffer[ i ] = twoDigits[ pair ];
+        pBuffer[ i + 1U ] = twoDigits[ pair + 1U ];
+    }
+
+    if( value >= 10U )
+    {
+        pair = ( size_t ) value * 2U;
+        pBuffer[ 0 ] = twoDigits[ pair ];
+        pBuffer[ 1 ] = twoDigits[ pair + 1U ];
+    }
+    else
+    {
+        pBuffer[ 0 ] = ( char ) ( '0' + ( char ) value );
+    }
+
+    return digits;
+}
+/*-----------------------------------------------------------*/
+
+static size_t BoundedLength( const char * pString,
+                             size_t maxLength )
+{
+    size_t length = 0;
+
+    #if ( SDP_TRUSTED_INPUT == 0 )
+        const char * pNull = NULL;
+    #endif
+
+    if( ( pString != NULL ) && ( maxLength > 0U ) )
+    {
+        #if ( SDP_TRUSTED_INPUT != 0 )
+            /* Trusted lengths never run past a NULL terminator. */
+            length = maxLength;
+        #else
+            pNull = memchr( pString, '\0', maxLength );
+            length = ( pNull != NULL ) ? ( size_t ) ( pNull - pString ) : maxLength;
+        #endif
+    }
+
+    return length;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t AppendLine( SdpSerializerContext_t * pCtx,
+                               uint8_t type,
+                               const SdpLineSegment_t * pSegments,
+                               size_t segmentCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, lineLength = SDP_LINE_OVERHEAD;
+    char * pWriteBuffer;
+
+    for( i = 0; i < segmentCount; i++ )
+    {
+        lineLength += pSegments[ i ].length;
+    }
+
+    if( pCtx->pIoVectors != NULL )
+    {
+        result = GatherLine( pCtx, type, pSegments, segmentCount, lineLength );
+    }
+    else if( ( pCtx->pStart != NULL ) || ( pCtx->growCallback != NULL ) )
+    {
+        /* Keep room for the NULL terminator after the line. */
+        if( lineLength >= ( pCtx->totalLength - pCtx->currentIndex ) )
+        {
+            if( pCtx->growCallback != NULL )
+            {
+                result = GrowBuffer( pCtx, pCtx->currentIndex + lineLength + 1U );
+            }
+            else
+            {
+                result = SDP_RESULT_OUT_OF_MEMORY;
+            }
+        }
+
+        if( result == SDP_RESULT_OK )
+        {
+            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
+            *pWriteBuffer++ = ( char ) type;
+            *pWriteBuffer++ = '=';
+
+            for( i = 0; i < segmentCount; i++ )
+            {
+                if( pSegments[ i ].length > 0U )
+                {
+                    ( void ) memcpy( pWriteBuffer, pSegments[ i ].pData, pSegments[ i ].length );
+                    pWriteBuffer += pSegments[ i ].length;
+                }
+            }
+
+            pWriteBuffer[ 0 ] = '\r';
+            pWriteBuffer[ 1 ] = '\n';
+            pWriteBuffer[ 2 ] = '\0';
+        }
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( pCtx->pIoVectors == NULL ) )
+    {
+        pCtx->currentIndex += lineLength;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t GatherLine( SdpSerializerContext_t * pCtx,
+                               uint8_t type,
+                               const SdpLineSegment_t * pSegments,
+                               size_t segmentCount,
+                               size_t lineLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t i, copyLength = SDP_LINE_OVERHEAD, ioVectorCount = 0;
+    uint8_t inScratch;
+    char prefix[ 2 ];
+
+    /* Count the pieces first so that a line is appended whole or not at all.
+     * Copies extend the previous piece while it ends in the scratch buffer. */
+    inScratch = ( ( pCtx->ioVectorCount > 0U ) &&
+                  ( ( pCtx->pIoVectors[ pCtx->ioVectorCount - 1U ].pBase +
+                      pCtx->pIoVectors[ pCtx->ioVectorCount - 1U ].length ) == &( pCtx->pStart[ pCtx->currentIndex ] ) ) ) ? 1U : 0U;
+
+    if( inScratch == 0U )
+    {
+        ioVectorCount++;
+        inScratch = 1U;
+    }
+
+    for( i = 0; i < segmentCount; i++ )
+    {
+        if( pSegments[ i ].length == 0U )
+        {
+            /* Nothing to add. */
+        }
+        else if( pSegments[ i ].isCallerData != 0U )
+        {
+            ioVectorCount++;
+            inScratch = 0U;
+        }
+        else
+        {
+            copyLength += pSegments[ i ].length;
+            ioVectorCount += ( inScratch == 0U ) ? 1U : 0U;
+            inScratch = 1U;
+        }
+    }
+
+    ioVectorCount += ( inScratch == 0U ) ? 1U : 0U;
+
+    if( ( copyLength > ( pCtx->totalLength - pCtx->currentIndex ) ) ||
+        ( ioVectorCount > ( pCtx->maxIoVectors - pCtx->ioVectorCount ) ) )
+    {
+        result = SDP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        prefix[ 0 ] = ( char ) type;
+        prefix[ 1 ] = '=';
+        GatherCopy( pCtx, &( prefix[ 0 ] ), 2U );
+
+        for( i = 0; i < segmentCount; i++ )
+        {
+            if( pSegments[ i ].length == 0U )
+            {
+                /* Nothing to add. */
+            }
+            else if( pSegments[ i ].isCallerData != 0U )
+            {
+                pCtx->pIoVectors[ pCtx->ioVectorCount ].pBase = pSegments[ i ].pData;
+                pCtx->pIoVectors[ pCtx->ioVectorCount ].length = pSegments[ i ].length;
+                pCtx->ioVectorCount++;
+            }
+            else
+            {
+                GatherCopy( pCtx, pSegments[ i ].pData, pSegments[ i ].length );
+            }
+        }
+
+        GatherCopy( pCtx, "\r\n", 2U );
+        pCtx->gatheredLength += lineLength;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static void GatherCopy( SdpSerializerContext_t * pCtx,
+                        const char * pData,
+                        size_t length )
+{
+    char * pCopy = &( pCtx->pStart[ pCtx->currentIndex ] );
+    SdpIoVector_t * pLast = NULL;
+
+    if( pCtx->ioVectorCount > 0U )
+    {
+        pLast = &( pCtx->pIoVectors[ pCtx->ioVectorCount - 1U ] );
+    }
+
+    ( void ) memcpy( pCopy, pData, length );
+    pCtx->currentIndex += length;
+
+    if( ( pLast != NULL ) && ( ( pLast->pBase + pLast->length ) == pCopy ) )
+    {
+        pLast->length += length;
+    }
+    else
+    {
+        pCtx->pIoVectors[ pCtx->ioVectorCount ].pBase = pCopy;
+        pCtx->pIoVectors[ pCtx->ioVectorCount ].length = length;
+        pCtx->ioVectorCount++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t GrowBuffer( SdpSerializerContext_t * pCtx,
+                               size_t requiredLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t newLength = requiredLength;
+    char * pNewBuffer;
+
+    /* Geometric growth keeps the number of copies logarithmic. */
+    if( ( pCtx->totalLength <= ( SIZE_MAX / 2U ) ) &&
+        ( ( pCtx->totalLength * 2U ) > newLength ) )
+    {
+        newLength = pCtx->totalLength * 2U;
+    }
+
+    pNewBuffer = pCtx->growCallback( pCtx->pGrowContext, pCtx->pStart, newLength );
+
+    if( pNewBuffer == NULL )
+    {
+        result = SDP_RESULT_OUT_OF_MEMORY;
+    }
+    else
+    {
+        pCtx->pStart = pNewBuffer;
+        pCtx->totalLength = newLength;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
 SdpResult_t SdpSerializer_Init( SdpSerializerContext_t * pCtx,
                                 char * pBuffer,
                                 size_t bufferLength )
@@ -18,60 +473,553 @@ SdpResult_t SdpSerializer_Init( SdpSerializerContext_t * pCtx,
 
     if( result == SDP_RESULT_OK )
     {
-        pCtx->pStart = pBuffer;
-        pCtx->totalLength = bufferLength;
-        pCtx->currentIndex = 0;
+        pCtx->pStart = pBuffer;
+        pCtx->totalLength = bufferLength;
+        pCtx->currentIndex = 0;
+        pCtx->growCallback = NULL;
+        pCtx->pGrowContext = NULL;
+        pCtx->pIoVectors = NULL;
+        pCtx->maxIoVectors = 0;
+        pCtx->ioVectorCount = 0;
+        pCtx->gatheredLength = 0;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_InitGrowable( SdpSerializerContext_t * pCtx,
+                                        char * pBuffer,
+                                        size_t bufferLength,
+                                        SdpSerializerGrowCallback_t growCallback,
+                                        void * pGrowContext )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( growCallback == NULL ) ||
+        ( ( pBuffer == NULL ) && ( bufferLength > 0U ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = SdpSerializer_Init( pCtx, pBuffer, bufferLength );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pCtx->growCallback = growCallback;
+        pCtx->pGrowContext = pGrowContext;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_InitGather( SdpSerializerContext_t * pCtx,
+                                      char * pScratch,
+                                      size_t scratchLength,
+                                      SdpIoVector_t * pIoVectors,
+                                      size_t maxIoVectors )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pScratch == NULL ) ||
+        ( pIoVectors == NULL ) ||
+        ( maxIoVectors == 0U ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = SdpSerializer_Init( pCtx, pScratch, scratchLength );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pCtx->pIoVectors = pIoVectors;
+        pCtx->maxIoVectors = maxIoVectors;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddBuffer( SdpSerializerContext_t * pCtx,
+                                     uint8_t type,
+                                     const char * pValue,
+                                     size_t valueLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segment;
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( pValue == NULL ) ||
+                         ( valueLength == 0 ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        segment.pData = pValue;
+        segment.length = BoundedLength( pValue, valueLength );
+        segment.isCallerData = 1U;
+
+        result = AppendLine( pCtx, type, &( segment ), 1 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddU32( SdpSerializerContext_t * pCtx,
+                                  uint8_t type,
+                                  uint32_t value )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segment;
+    char digits[ SDP_MAX_UINT64_DIGITS ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        segment.pData = &( digits[ 0 ] );
+        segment.length = FormatUnsignedInteger( &( digits[ 0 ] ), value );
+        segment.isCallerData = 0U;
+
+        result = AppendLine( pCtx, type, &( segment ), 1 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddU64( SdpSerializerContext_t * pCtx,
+                                  uint8_t type,
+                                  uint64_t value )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segment;
+    char digits[ SDP_MAX_UINT64_DIGITS ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        segment.pData = &( digits[ 0 ] );
+        segment.length = FormatUnsignedInteger( &( digits[ 0 ] ), value );
+        segment.isCallerData = 0U;
+
+        result = AppendLine( pCtx, type, &( segment ), 1 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddOriginator( SdpSerializerContext_t * pCtx,
+                                         uint8_t type,
+                                         const SdpOriginator_t * pOriginator )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 5 ];
+    char sessionId[ SDP_MAX_UINT64_DIGITS + 1 ];
+    char sessionVersion[ SDP_MAX_UINT64_DIGITS + 1 ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pOriginator == NULL ) ||
+                         ( pOriginator->connectionInfo.pAddress == NULL ) ||
+                         ( pOriginator->connectionInfo.networkType != SDP_NETWORK_IN ) ||
+                         ( ( pOriginator->connectionInfo.addressType != SDP_ADDRESS_IPV4 ) &&
+                           ( pOriginator->connectionInfo.addressType != SDP_ADDRESS_IPV6 ) ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* <username> <sess-id> <sess-version> IN <addrtype> <address> */
+        sessionId[ 0 ] = ' ';
+        sessionVersion[ 0 ] = ' ';
+
+        segments[ 0 ].pData = pOriginator->pUserName;
+        segments[ 0 ].length = BoundedLength( pOriginator->pUserName, pOriginator->userNameLength );
+        segments[ 0 ].isCallerData = 1U;
+        segments[ 1 ].pData = &( sessionId[ 0 ] );
+        segments[ 1 ].length = 1U + FormatUnsignedInteger( &( sessionId[ 1 ] ), pOriginator->sessionId );
+        segments[ 1 ].isCallerData = 0U;
+        segments[ 2 ].pData = &( sessionVersion[ 0 ] );
+        segments[ 2 ].length = 1U + FormatUnsignedInteger( &( sessionVersion[ 1 ] ), pOriginator->sessionVersion );
+        segments[ 2 ].isCallerData = 0U;
+        segments[ 3 ].pData = ( pOriginator->connectionInfo.addressType == SDP_ADDRESS_IPV4 ) ? " IN IP4 " : " IN IP6 ";
+        segments[ 3 ].length = 8U;
+        segments[ 3 ].isCallerData = 0U;
+        segments[ 4 ].pData = pOriginator->connectionInfo.pAddress;
+        segments[ 4 ].length = BoundedLength( pOriginator->connectionInfo.pAddress, pOriginator->connectionInfo.addressLength );
+        segments[ 4 ].isCallerData = 1U;
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), 5 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddConnectionInfo( SdpSerializerContext_t * pCtx,
+                                             uint8_t type,
+                                             const SdpConnectionInfo_t * pConnInfo )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 2 ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pConnInfo == NULL ) ||
+                         ( pConnInfo->networkType != SDP_NETWORK_IN ) ||
+                         ( pConnInfo->pAddress == NULL ) ||
+                         ( ( pConnInfo->addressType != SDP_ADDRESS_IPV4 ) &&
+                           ( pConnInfo->addressType != SDP_ADDRESS_IPV6 ) ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        segments[ 0 ].pData = ( pConnInfo->addressType == SDP_ADDRESS_IPV4 ) ? "IN IP4 " : "IN IP6 ";
+        segments[ 0 ].length = 7U;
+        segments[ 0 ].isCallerData = 0U;
+        segments[ 1 ].pData = pConnInfo->pAddress;
+        segments[ 1 ].length = BoundedLength( pConnInfo->pAddress, pConnInfo->addressLength );
+        segments[ 1 ].isCallerData = 1U;
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), 2 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddBandwidthInfo( SdpSerializerContext_t * pCtx,
+                                            uint8_t type,
+                                            const SdpBandwidthInfo_t * pBandwidthInfo )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 2 ];
+    char bandwidth[ SDP_MAX_UINT64_DIGITS + 1 ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pBandwidthInfo == NULL ) ||
+                         ( pBandwidthInfo->pBwType == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        bandwidth[ 0 ] = ':';
+
+        segments[ 0 ].pData = pBandwidthInfo->pBwType;
+        segments[ 0 ].length = BoundedLength( pBandwidthInfo->pBwType, pBandwidthInfo->bwTypeLength );
+        segments[ 0 ].isCallerData = 1U;
+        segments[ 1 ].pData = &( bandwidth[ 0 ] );
+        segments[ 1 ].length = 1U + FormatUnsignedInteger( &( bandwidth[ 1 ] ), pBandwidthInfo->sdpBandwidthValue );
+        segments[ 1 ].isCallerData = 0U;
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), 2 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddTimeActive( SdpSerializerContext_t * pCtx,
+                                         uint8_t type,
+                                         const SdpTimeDescription_t * pTimeDescription )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 2 ];
+    char startTime[ SDP_MAX_UINT64_DIGITS ];
+    char stopTime[ SDP_MAX_UINT64_DIGITS + 1 ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pTimeDescription == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        stopTime[ 0 ] = ' ';
+
+        segments[ 0 ].pData = &( startTime[ 0 ] );
+        segments[ 0 ].length = FormatUnsignedInteger( &( startTime[ 0 ] ), pTimeDescription->startTime );
+        segments[ 0 ].isCallerData = 0U;
+        segments[ 1 ].pData = &( stopTime[ 0 ] );
+        segments[ 1 ].length = 1U + FormatUnsignedInteger( &( stopTime[ 1 ] ), pTimeDescription->stopTime );
+        segments[ 1 ].isCallerData = 0U;
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), 2 );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddAttribute( SdpSerializerContext_t * pCtx,
+                                        uint8_t type,
+                                        const SdpAttribute_t * pAttribute )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 3 ];
+    size_t segmentCount = 1;
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pAttribute == NULL ) ||
+                         ( pAttribute->pAttributeName == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        segments[ 0 ].pData = pAttribute->pAttributeName;
+        segments[ 0 ].length = BoundedLength( pAttribute->pAttributeName, pAttribute->attributeNameLength );
+        segments[ 0 ].isCallerData = 1U;
+
+        if( pAttribute->pAttributeValue != NULL )
+        {
+            segments[ 1 ].pData = ":";
+            segments[ 1 ].length = 1U;
+            segments[ 1 ].isCallerData = 0U;
+            segments[ 2 ].pData = pAttribute->pAttributeValue;
+            segments[ 2 ].length = BoundedLength( pAttribute->pAttributeValue, pAttribute->attributeValueLength );
+            segments[ 2 ].isCallerData = 1U;
+            segmentCount = 3;
+        }
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), segmentCount );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_AddMedia( SdpSerializerContext_t * pCtx,
+                                    uint8_t type,
+                                    const SdpMedia_t * pMedia )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpLineSegment_t segments[ 7 ];
+    size_t segmentCount = 0;
+    char port[ SDP_MAX_UINT64_DIGITS + 1 ];
+    char portNum[ SDP_MAX_UINT64_DIGITS + 1 ];
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pMedia == NULL ) ||
+                         ( pMedia->pProtocol == NULL ) ||
+                         ( pMedia->pFmt == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* <media> <port>[/<number of ports>] <proto> <fmt> */
+        port[ 0 ] = ' ';
+        portNum[ 0 ] = '/';
+
+        segments[ segmentCount ].pData = pMedia->pMedia;
+        segments[ segmentCount ].length = BoundedLength( pMedia->pMedia, pMedia->mediaLength );
+        segments[ segmentCount ].isCallerData = 1U;
+        segmentCount++;
+        segments[ segmentCount ].pData = &( port[ 0 ] );
+        segments[ segmentCount ].length = 1U + FormatUnsignedInteger( &( port[ 1 ] ), pMedia->port );
+        segments[ segmentCount ].isCallerData = 0U;
+        segmentCount++;
+
+        if( pMedia->portNum != 0 )
+        {
+            segments[ segmentCount ].pData = &( portNum[ 0 ] );
+            segments[ segmentCount ].length = 1U + FormatUnsignedInteger( &( portNum[ 1 ] ), pMedia->portNum );
+            segments[ segmentCount ].isCallerData = 0U;
+            segmentCount++;
+        }
+
+        segments[ segmentCount ].pData = " ";
+        segments[ segmentCount ].length = 1U;
+        segments[ segmentCount ].isCallerData = 0U;
+        segmentCount++;
+        segments[ segmentCount ].pData = pMedia->pProtocol;
+        segments[ segmentCount ].length = BoundedLength( pMedia->pProtocol, pMedia->protocolLength );
+        segments[ segmentCount ].isCallerData = 1U;
+        segmentCount++;
+        segments[ segmentCount ].pData = " ";
+        segments[ segmentCount ].length = 1U;
+        segments[ segmentCount ].isCallerData = 0U;
+        segmentCount++;
+        segments[ segmentCount ].pData = pMedia->pFmt;
+        segments[ segmentCount ].length = BoundedLength( pMedia->pFmt, pMedia->fmtLength );
+        segments[ segmentCount ].isCallerData = 1U;
+        segmentCount++;
+
+        result = AppendLine( pCtx, type, &( segments[ 0 ] ), segmentCount );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_Finalize( SdpSerializerContext_t * pCtx,
+                                    const char ** pSdpMessage,
+                                    size_t * pSdpMessageLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( ( pCtx->pStart != NULL ) &&
+                           ( pCtx->currentIndex > pCtx->totalLength ) ) ||
+                         ( pCtx->pIoVectors != NULL ) ||
+                         ( pSdpMessage == NULL ) ||
+                         ( pSdpMessageLength == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *pSdpMessage = pCtx->pStart;
+        *pSdpMessageLength = pCtx->currentIndex;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSerializer_FinalizeGather( SdpSerializerContext_t * pCtx,
+                                          size_t * pIoVectorCount,
+                                          size_t * pSdpMessageLength )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( pCtx->pIoVectors == NULL ) ||
+                         ( pIoVectorCount == NULL ) ||
+                         ( pSdpMessageLength == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *pIoVectorCount = pCtx->ioVectorCount;
+        *pSdpMessageLength = pCtx->gatheredLength;
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddBuffer( SdpSerializerContext_t * pCtx,
-                                     uint8_t type,
-                                     const char * pValue,
-                                     size_t valueLength )
+SdpResult_t SdpSerializer_AddSession( SdpSerializerContext_t * pCtx,
+                                      const SdpSessionDescription_t * pSession )
 {
-    int snprintfRetVal;
     SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    const SdpMediaDescription_t * pMediaDescription;
+    size_t i, j;
 
-    if( ( pCtx == NULL ) ||
-        ( pValue == NULL ) ||
-        ( valueLength == 0 ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) )
+    if( SDP_CHECK_INPUT( ( pCtx == NULL ) ||
+                         ( pSession == NULL ) ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
 
     if( result == SDP_RESULT_OK )
     {
-        if( pCtx->pStart != NULL )
+        result = SdpSerializer_AddU32( pCtx, SDP_TYPE_VERSION, pSession->version );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        result = SdpSerializer_AddOriginator( pCtx, SDP_TYPE_ORIGINATOR, &( pSession->originator ) );
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( SdpSerializer_GetBufferLineLength( pSession->pSessionName, pSession->sessionNameLength ) > SDP_LINE_OVERHEAD ) )
+    {
+        result = SdpSerializer_AddBuffer( pCtx, SDP_TYPE_SESSION_NAME, pSession->pSessionName, pSession->sessionNameLength );
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( SdpSerializer_GetBufferLineLength( pSession->pSessionInfo, pSession->sessionInfoLength ) > SDP_LINE_OVERHEAD ) )
+    {
+        result = SdpSerializer_AddBuffer( pCtx, SDP_TYPE_SESSION_INFO, pSession->pSessionInfo, pSession->sessionInfoLength );
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSession->connectionInfoCount ); i++ )
+    {
+        result = SdpSerializer_AddConnectionInfo( pCtx, SDP_TYPE_CONNINFO, &( pSession->pConnectionInfos[ i ] ) );
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSession->bandwidthInfoCount ); i++ )
+    {
+        result = SdpSerializer_AddBandwidthInfo( pCtx, SDP_TYPE_BANDWIDTH, &( pSession->pBandwidthInfos[ i ] ) );
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSession->timeDescriptionCount ); i++ )
+    {
+        result = SdpSerializer_AddTimeActive( pCtx, SDP_TYPE_TIME_ACTIVE, &( pSession->pTimeDescriptions[ i ] ) );
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSession->attributeCount ); i++ )
+    {
+        result = SdpSerializer_AddAttribute( pCtx, SDP_TYPE_ATTRIBUTE, &( pSession->pAttributes[ i ] ) );
+    }
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSession->mediaDescriptionCount ); i++ )
+    {
+        pMediaDescription = &( pSession->pMediaDescriptions[ i ] );
+        result = SdpSerializer_AddMedia( pCtx, SDP_TYPE_MEDIA, &( pMediaDescription->media ) );
+
+        if( ( result == SDP_RESULT_OK ) && ( SdpSerializer_GetBufferLineLength( pMediaDescription->pMediaTitle, pMediaDescription->mediaTitleLength ) > SDP_LINE_OVERHEAD ) )
         {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
+            result = SdpSerializer_AddBuffer( pCtx, SDP_TYPE_MEDIA_TITLE, pMediaDescription->pMediaTitle, pMediaDescription->mediaTitleLength );
         }
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c=%.*s\r\n",
-                                   type,
-                                   ( int ) valueLength, pValue );
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
+        for( j = 0; ( result == SDP_RESULT_OK ) && ( j < pMediaDescription->connectionInfoCount ); j++ )
         {
-            result = SDP_RESULT_SNPRINTF_ERROR;
+            result = SdpSerializer_AddConnectionInfo( pCtx, SDP_TYPE_CONNINFO, &( pMediaDescription->pConnectionInfos[ j ] ) );
         }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+
+        for( j = 0; ( result == SDP_RESULT_OK ) && ( j < pMediaDescription->bandwidthInfoCount ); j++ )
         {
-            result = SDP_RESULT_OUT_OF_MEMORY;
+            result = SdpSerializer_AddBandwidthInfo( pCtx, SDP_TYPE_BANDWIDTH, &( pMediaDescription->pBandwidthInfos[ j ] ) );
         }
-        else
+
+        for( j = 0; ( result == SDP_RESULT_OK ) && ( j < pMediaDescription->attributeCount ); j++ )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            result = SdpSerializer_AddAttribute( pCtx, SDP_TYPE_ATTRIBUTE, &( pMediaDescription->pAttributes[ j ] ) );
         }
     }
 
@@ -79,474 +1027,515 @@ SdpResult_t SdpSerializer_AddBuffer( SdpSerializerContext_t * pCtx,
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddU32( SdpSerializerContext_t * pCtx,
-                                  uint8_t type,
-                                  uint32_t value )
+size_t SdpSerializer_GetBufferLineLength( const char * pValue,
+                                          size_t valueLength )
 {
-    int snprintfRetVal;
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    return SDP_LINE_OVERHEAD + BoundedLength( pValue, valueLength );
+}
+/*-----------------------------------------------------------*/
+
+size_t SdpSerializer_GetU32LineLength( uint32_t value )
+{
+    return SDP_LINE_OVERHEAD + CountDigits( value );
+}
+/*-----------------------------------------------------------*/
 
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) )
+size_t SdpSerializer_GetU64LineLength( uint64_t value )
+{
+    return SDP_LINE_OVERHEAD + CountDigits( value );
+}
+/*-----------------------------------------------------------*/
+
+size_t SdpSerializer_GetOriginatorLineLength( const SdpOriginator_t * pOriginator )
+{
+    size_t length = 0;
+
+    if( pOriginator != NULL )
     {
-        result = SDP_RESULT_BAD_PARAM;
+        /* Two spaces and " IN IP4 " or " IN IP6 ". */
+        length = SDP_LINE_OVERHEAD + 10U +
+                 BoundedLength( pOriginator->pUserName, pOriginator->userNameLength ) +
+                 CountDigits( pOriginator->sessionId ) +
+                 CountDigits( pOriginator->sessionVersion ) +
+                 BoundedLength( pOriginator->connectionInfo.pAddress, pOriginator->connectionInfo.addressLength );
     }
 
-    if( result == SDP_RESULT_OK )
+    return length;
+}
+/*-----------------------------------------------------------*/
+
+size_t SdpSerializer_GetConnectionInfoLineLength( const SdpConnectionInfo_t * pConnInfo )
+{
+    size_t length = 0;
+
+    if( pConnInfo != NULL )
     {
-        if( pCtx->pStart != NULL )
-        {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
-        }
+        /* "IN IP4 " or "IN IP6 ". */
+        length = SDP_LINE_OVERHEAD + 7U +
+                 BoundedLength( pConnInfo->pAddress, pConnInfo->addressLength );
+    }
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c"
-                                   "=%" SDP_PRINT_FMT_UINT32 "\r\n",
-                                   type,
-                                   value );
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
-        {
-            result = SDP_RESULT_SNPRINTF_ERROR;
-        }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
-        {
-            result = SDP_RESULT_OUT_OF_MEMORY;
-        }
-        else
-        {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
-        }
+    return length;
+}
+/*-----------------------------------------------------------*/
+
+size_t SdpSerializer_GetBandwidthInfoLineLength( const SdpBandwidthInfo_t * pBandwidthInfo )
+{
+    size_t length = 0;
+
+    if( pBandwidthInfo != NULL )
+    {
+        length = SDP_LINE_OVERHEAD + 1U +
+                 BoundedLength( pBandwidthInfo->pBwType, pBandwidthInfo->bwTypeLength ) +
+                 CountDigits( pBandwidthInfo->sdpBandwidthValue );
     }
 
-    return result;
+    return length;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddU64( SdpSerializerContext_t * pCtx,
-                                  uint8_t type,
-                                  uint64_t value )
+size_t SdpSerializer_GetTimeActiveLineLength( const SdpTimeDescription_t * pTimeDescription )
 {
-    int snprintfRetVal;
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    size_t length = 0;
 
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) )
+    if( pTimeDescription != NULL )
     {
-        result = SDP_RESULT_BAD_PARAM;
+        length = SDP_LINE_OVERHEAD + 1U +
+                 CountDigits( pTimeDescription->startTime ) +
+                 CountDigits( pTimeDescription->stopTime );
     }
 
-    if( result == SDP_RESULT_OK )
+    return length;
+}
+/*-----------------------------------------------------------*/
+
+size_t SdpSerializer_GetAttributeLineLength( const SdpAttribute_t * pAttribute )
+{
+    size_t length = 0;
+
+    if( pAttribute != NULL )
     {
-        if( pCtx->pStart != NULL )
-        {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
-        }
+        length = SDP_LINE_OVERHEAD + BoundedLength( pAttribute->pAttributeName, pAttribute->attributeNameLength );
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c"
-                                   "=%" SDP_PRINT_FMT_UINT64 "\r\n",
-                                   type,
-                                   value );
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
-        {
-            result = SDP_RESULT_SNPRINTF_ERROR;
-        }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
-        {
-            result = SDP_RESULT_OUT_OF_MEMORY;
-        }
-        else
+        if( pAttribute->pAttributeValue != NULL )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            length += 1U + BoundedLength( pAttribute->pAttributeValue, pAttribute->attributeValueLength );
         }
     }
 
-    return result;
+    return length;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddOriginator( SdpSerializerContext_t * pCtx,
-                                         uint8_t type,
-                                         const SdpOriginator_t * pOriginator )
+size_t SdpSerializer_GetMediaLineLength( const SdpMedia_t * pMedia )
 {
-    int snprintfRetVal;
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
-
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pOriginator == NULL ) ||
-        ( pOriginator->connectionInfo.pAddress == NULL ) ||
-        ( pOriginator->connectionInfo.networkType != SDP_NETWORK_IN ) ||
-        ( ( pOriginator->connectionInfo.addressType != SDP_ADDRESS_IPV4 ) &&
-          ( pOriginator->connectionInfo.addressType != SDP_ADDRESS_IPV6 ) ) )
-    {
-        result = SDP_RESULT_BAD_PARAM;
-    }
+    size_t length = 0;
 
-    if( result == SDP_RESULT_OK )
+    if( pMedia != NULL )
     {
-        if( pCtx->pStart != NULL )
-        {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
-        }
-
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c"
-                                   "=%.*s"
-                                   " %" SDP_PRINT_FMT_UINT64
-                                   " %" SDP_PRINT_FMT_UINT64
-                                   " %.*s"
-                                   " %.*s"
-                                   " %.*s\r\n",
-                                   type,
-                                   ( int ) pOriginator->userNameLength, pOriginator->pUserName,
-                                   pOriginator->sessionId,
-                                   pOriginator->sessionVersion,
-                                   2, "IN",
-                                   3, pOriginator->connectionInfo.addressType == SDP_ADDRESS_IPV4 ? "IP4" : "IP6",
-                                   ( int ) pOriginator->connectionInfo.addressLength, pOriginator->connectionInfo.pAddress );
-
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
-        {
-            result = SDP_RESULT_SNPRINTF_ERROR;
-        }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
-        {
-            result = SDP_RESULT_OUT_OF_MEMORY;
-        }
-        else
+        /* Three spaces. */
+        length = SDP_LINE_OVERHEAD + 3U +
+                 BoundedLength( pMedia->pMedia, pMedia->mediaLength ) +
+                 CountDigits( pMedia->port ) +
+                 BoundedLength( pMedia->pProtocol, pMedia->protocolLength ) +
+                 BoundedLength( pMedia->pFmt, pMedia->fmtLength );
+
+        if( pMedia->portNum != 0 )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            length += 1U + CountDigits( pMedia->portNum );
         }
     }
 
-    return result;
+    return length;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddConnectionInfo( SdpSerializerContext_t * pCtx,
-                                             uint8_t type,
-                                             const SdpConnectionInfo_t * pConnInfo )
+size_t SdpSerializer_GetSessionBufferLength( const SdpSessionDescription_t * pSession )
 {
-    int snprintfRetVal;
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
-
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pConnInfo == NULL ) ||
-        ( pConnInfo->networkType != SDP_NETWORK_IN ) ||
-        ( pConnInfo->pAddress == NULL ) ||
-        ( ( pConnInfo->addressType != SDP_ADDRESS_IPV4 ) &&
-          ( pConnInfo->addressType != SDP_ADDRESS_IPV6 ) ) )
-    {
-        result = SDP_RESULT_BAD_PARAM;
-    }
+    const SdpMediaDescription_t * pMediaDescription;
+    size_t length = 0, lineLength, i, j;
 
-    if( result == SDP_RESULT_OK )
+    if( pSession != NULL )
     {
-        if( pCtx->pStart != NULL )
+        /* The NULL terminator. */
+        length = 1U;
+        length += SdpSerializer_GetU32LineLength( pSession->version );
+        length += SdpSerializer_GetOriginatorLineLength( &( pSession->originator ) );
+
+        lineLength = SdpSerializer_GetBufferLineLength( pSession->pSessionName, pSession->sessionNameLength );
+        length += ( lineLength > SDP_LINE_OVERHEAD ) ? lineLength : 0U;
+
+        lineLength = SdpSerializer_GetBufferLineLength( pSession->pSessionInfo, pSession->sessionInfoLength );
+        length += ( lineLength > SDP_LINE_OVERHEAD ) ? lineLength : 0U;
+
+        for( i = 0; i < pSession->connectionInfoCount; i++ )
         {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
+            length += SdpSerializer_GetConnectionInfoLineLength( &( pSession->pConnectionInfos[ i ] ) );
         }
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c=%.*s %.*s %.*s\r\n",
-                                   type,
-                                   2, "IN",
-                                   3, pConnInfo->addressType == SDP_ADDRESS_IPV4 ? "IP4" : "IP6",
-                                   ( int ) pConnInfo->addressLength, pConnInfo->pAddress );
+        for( i = 0; i < pSession->bandwidthInfoCount; i++ )
+        {
+            length += SdpSerializer_GetBandwidthInfoLineLength( &( pSession->pBandwidthInfos[ i ] ) );
+        }
 
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
+        for( i = 0; i < pSession->timeDescriptionCount; i++ )
         {
-            result = SDP_RESULT_SNPRINTF_ERROR;
+            length += SdpSerializer_GetTimeActiveLineLength( &( pSession->pTimeDescriptions[ i ] ) );
         }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+
+        for( i = 0; i < pSession->attributeCount; i++ )
         {
-            result = SDP_RESULT_OUT_OF_MEMORY;
+            length += SdpSerializer_GetAttributeLineLength( &( pSession->pAttributes[ i ] ) );
         }
-        else
+
+        for( i = 0; i < pSession->mediaDescriptionCount; i++ )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            pMediaDescription = &( pSession->pMediaDescriptions[ i ] );
+            length += SdpSerializer_GetMediaLineLength( &( pMediaDescription->media ) );
+
+            lineLength = SdpSerializer_GetBufferLineLength( pMediaDescription->pMediaTitle, pMediaDescription->mediaTitleLength );
+            length += ( lineLength > SDP_LINE_OVERHEAD ) ? lineLength : 0U;
+
+            for( j = 0; j < pMediaDescription->connectionInfoCount; j++ )
+            {
+                length += SdpSerializer_GetConnectionInfoLineLength( &( pMediaDescription->pConnectionInfos[ j ] ) );
+            }
+
+            for( j = 0; j < pMediaDescription->bandwidthInfoCount; j++ )
+            {
+                length += SdpSerializer_GetBandwidthInfoLineLength( &( pMediaDescription->pBandwidthInfos[ j ] ) );
+            }
+
+            for( j = 0; j < pMediaDescription->attributeCount; j++ )
+            {
+                length += SdpSerializer_GetAttributeLineLength( &( pMediaDescription->pAttributes[ j ] ) );
+            }
         }
     }
 
-    return result;
+    return length;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddBandwidthInfo( SdpSerializerContext_t * pCtx,
-                                            uint8_t type,
-                                            const SdpBandwidthInfo_t * pBandwidthInfo )
+SdpResult_t SdpSerializer_CompileTemplate( SdpTemplate_t * pTemplate,
+                                           const char * pSkeleton,
+                                           size_t skeletonLength,
+                                           const char * const * ppPlaceholderNames,
+                                           size_t placeholderCount,
+                                           SdpTemplatePart_t * pParts,
+                                           size_t maxParts,
+                                           size_t * pPartCount )
 {
-    int snprintfRetVal;
     SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    size_t partCount = 0, spanStart = 0, searchIndex = 0, openIndex, nameLength, i;
+    size_t placeholderIndex;
+    const char * pOpen = NULL;
+    const char * pClose = NULL;
 
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pBandwidthInfo == NULL ) ||
-        ( pBandwidthInfo->pBwType == NULL ) )
+    if( ( pTemplate == NULL ) ||
+        ( pSkeleton == NULL ) ||
+        ( ( ppPlaceholderNames == NULL ) && ( placeholderCount > 0U ) ) ||
+        ( pPartCount == NULL ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
 
-    if( result == SDP_RESULT_OK )
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < placeholderCount ); i++ )
     {
-        if( pCtx->pStart != NULL )
+        if( ppPlaceholderNames[ i ] == NULL )
         {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
+            result = SDP_RESULT_BAD_PARAM;
         }
+    }
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c=%.*s"
-                                   ":%" SDP_PRINT_FMT_UINT64 "\r\n",
-                                   type,
-                                   ( int ) pBandwidthInfo->bwTypeLength, pBandwidthInfo->pBwType,
-                                   pBandwidthInfo->sdpBandwidthValue );
+    while( ( result == SDP_RESULT_OK ) && ( searchIndex < skeletonLength ) )
+    {
+        pOpen = memchr( &( pSkeleton[ searchIndex ] ), '{', skeletonLength - searchIndex );
 
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
+        if( pOpen == NULL )
         {
-            result = SDP_RESULT_SNPRINTF_ERROR;
+            break;
         }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+
+        openIndex = ( size_t ) ( pOpen - pSkeleton );
+        pClose = memchr( &( pOpen[ 1 ] ), '}', skeletonLength - openIndex - 1U );
+
+        if( pClose == NULL )
         {
-            result = SDP_RESULT_OUT_OF_MEMORY;
+            break;
+        }
+
+        nameLength = ( size_t ) ( pClose - pOpen ) - 1U;
+        placeholderIndex = SDP_TEMPLATE_NO_PLACEHOLDER;
+
+        for( i = 0; i < placeholderCount; i++ )
+        {
+            if( ( strlen( ppPlaceholderNames[ i ] ) == nameLength ) &&
+                ( memcmp( ppPlaceholderNames[ i ], &( pOpen[ 1 ] ), nameLength ) == 0 ) )
+            {
+                placeholderIndex = i;
+                break;
+            }
+        }
+
+        if( placeholderIndex == SDP_TEMPLATE_NO_PLACEHOLDER )
+        {
+            /* Not a placeholder, look for the next brace. */
+            searchIndex = openIndex + 1U;
         }
         else
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            if( ( pParts != NULL ) && ( partCount < maxParts ) )
+            {
+                pParts[ partCount ].offset = spanStart;
+                pParts[ partCount ].length = openIndex - spanStart;
+                pParts[ partCount ].placeholderIndex = placeholderIndex;
+            }
+
+            partCount++;
+            spanStart = openIndex + nameLength + 2U;
+            searchIndex = spanStart;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        /* The static text after the last placeholder. */
+        if( ( pParts != NULL ) && ( partCount < maxParts ) )
+        {
+            pParts[ partCount ].offset = spanStart;
+            pParts[ partCount ].length = skeletonLength - spanStart;
+            pParts[ partCount ].placeholderIndex = SDP_TEMPLATE_NO_PLACEHOLDER;
+        }
+
+        partCount++;
+
+        if( ( pParts != NULL ) && ( partCount > maxParts ) )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
         }
+
+        pTemplate->pSkeleton = pSkeleton;
+        pTemplate->pParts = ( result == SDP_RESULT_OK ) ? pParts : NULL;
+        pTemplate->partCount = ( result == SDP_RESULT_OK ) ? partCount : 0U;
+        pTemplate->placeholderCount = placeholderCount;
+        *pPartCount = partCount;
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddTimeActive( SdpSerializerContext_t * pCtx,
-                                         uint8_t type,
-                                         const SdpTimeDescription_t * pTimeDescription )
+SdpResult_t SdpSerializer_RenderTemplate( const SdpTemplate_t * pTemplate,
+                                          const SdpTemplateValue_t * pValues,
+                                          size_t valueCount,
+                                          char * pBuffer,
+                                          size_t bufferLength,
+                                          size_t * pMessageLength )
 {
-    int snprintfRetVal;
     SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    const SdpTemplatePart_t * pPart;
+    const SdpTemplateValue_t * pValue;
+    size_t messageLength = 0, i;
+    char * pWriteBuffer = pBuffer;
 
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pTimeDescription == NULL ) )
+    if( SDP_CHECK_INPUT( ( pTemplate == NULL ) ||
+                         ( pTemplate->pParts == NULL ) ||
+                         ( ( pValues == NULL ) && ( pTemplate->placeholderCount > 0U ) ) ||
+                         ( pMessageLength == NULL ) ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else if( valueCount < pTemplate->placeholderCount )
     {
+        /* Kept in trusted mode: it keeps pValues reads in bounds. */
         result = SDP_RESULT_BAD_PARAM;
     }
 
     if( result == SDP_RESULT_OK )
     {
-        if( pCtx->pStart != NULL )
+        for( i = 0; i < pTemplate->partCount; i++ )
         {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
+            pPart = &( pTemplate->pParts[ i ] );
+            messageLength += pPart->length;
+
+            if( pPart->placeholderIndex != SDP_TEMPLATE_NO_PLACEHOLDER )
+            {
+                pValue = &( pValues[ pPart->placeholderIndex ] );
+                messageLength += ( pValue->pValue != NULL ) ? pValue->valueLength : CountDigits( pValue->number );
+            }
         }
 
-        snprintfRetVal = snprintf( pWriteBuffer,
-                                   remainingLength,
-                                   "%c"
-                                   "=%" SDP_PRINT_FMT_UINT64
-                                   " %" SDP_PRINT_FMT_UINT64 "\r\n",
-                                   type,
-                                   pTimeDescription->startTime,
-                                   pTimeDescription->stopTime );
+        *pMessageLength = messageLength;
 
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
-        {
-            result = SDP_RESULT_SNPRINTF_ERROR;
-        }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+        /* Keep room for the NULL terminator. */
+        if( ( pBuffer != NULL ) && ( messageLength >= bufferLength ) )
         {
             result = SDP_RESULT_OUT_OF_MEMORY;
         }
-        else
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( pBuffer != NULL ) )
+    {
+        for( i = 0; i < pTemplate->partCount; i++ )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            pPart = &( pTemplate->pParts[ i ] );
+            ( void ) memcpy( pWriteBuffer, &( pTemplate->pSkeleton[ pPart->offset ] ), pPart->length );
+            pWriteBuffer += pPart->length;
+
+            if( pPart->placeholderIndex == SDP_TEMPLATE_NO_PLACEHOLDER )
+            {
+                /* The last static span. */
+            }
+            else if( pValues[ pPart->placeholderIndex ].pValue != NULL )
+            {
+                pValue = &( pValues[ pPart->placeholderIndex ] );
+                ( void ) memcpy( pWriteBuffer, pValue->pValue, pValue->valueLength );
+                pWriteBuffer += pValue->valueLength;
+            }
+            else
+            {
+                pWriteBuffer += FormatUnsignedInteger( pWriteBuffer, pValues[ pPart->placeholderIndex ].number );
+            }
         }
+
+        *pWriteBuffer = '\0';
     }
 
     return result;
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_AddAttribute( SdpSerializerContext_t * pCtx,
-                                        uint8_t type,
-                                        const SdpAttribute_t * pAttribute )
+static SdpResult_t RewriteSessionVersion( char * pBuffer,
+                                          size_t bufferLength,
+                                          size_t * pMessageLength,
+                                          uint8_t increment,
+                                          uint64_t sessionVersion,
+                                          size_t minimumDigits,
+                                          uint64_t * pSessionVersion )
 {
-    int snprintfRetVal;
     SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
+    size_t messageLength = 0, lineStart = 0, lineEnd = 0, versionStart = 0, versionEnd, spaceCount = 0;
+    size_t oldWidth, newWidth, digits, i;
+    uint64_t version = 0, digit;
+    const char * pNewline;
 
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pAttribute == NULL ) ||
-        ( pAttribute->pAttributeName == NULL ) )
+    if( ( pBuffer == NULL ) ||
+        ( pMessageLength == NULL ) ||
+        ( *pMessageLength >= bufferLength ) ||
+        ( minimumDigits > ( size_t ) SDP_MAX_UINT64_DIGITS ) )
     {
         result = SDP_RESULT_BAD_PARAM;
     }
+    else
+    {
+        messageLength = *pMessageLength;
+        result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+    }
 
-    if( result == SDP_RESULT_OK )
+    /* Find the "o=" line. */
+    while( ( result == SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO ) && ( ( lineStart + 2U ) <= messageLength ) )
     {
-        if( pCtx->pStart != NULL )
-        {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
-        }
+        pNewline = memchr( &( pBuffer[ lineStart ] ), '\n', messageLength - lineStart );
+        lineEnd = ( pNewline != NULL ) ? ( size_t ) ( pNewline - pBuffer ) : messageLength;
 
-        if( pAttribute->pAttributeValue != NULL )
+        if( ( pBuffer[ lineStart ] == ( char ) SDP_TYPE_ORIGINATOR ) && ( pBuffer[ lineStart + 1U ] == '=' ) )
         {
-            snprintfRetVal = snprintf( pWriteBuffer,
-                                       remainingLength,
-                                       "%c=%.*s:%.*s\r\n",
-                                       type,
-                                       ( int ) pAttribute->attributeNameLength, pAttribute->pAttributeName,
-                                       ( int ) pAttribute->attributeValueLength, pAttribute->pAttributeValue );
+            result = SDP_RESULT_OK;
         }
         else
         {
-            snprintfRetVal = snprintf( pWriteBuffer,
-                                       remainingLength,
-                                       "%c=%.*s\r\n",
-                                       type,
-                                       ( int ) pAttribute->attributeNameLength, pAttribute->pAttributeName );
+            lineStart = lineEnd + 1U;
         }
+    }
 
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
+    if( result == SDP_RESULT_OK )
+    {
+        /* <username> <sess-id> <sess-version> ... */
+        for( i = lineStart + 2U; ( i < lineEnd ) && ( spaceCount < 2U ); i++ )
         {
-            result = SDP_RESULT_SNPRINTF_ERROR;
+            if( pBuffer[ i ] == ' ' )
+            {
+                spaceCount++;
+            }
         }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+
+        versionStart = i;
+
+        for( versionEnd = versionStart; ( versionEnd < lineEnd ) && ( pBuffer[ versionEnd ] >= '0' ) && ( pBuffer[ versionEnd ] <= '9' ); versionEnd++ )
         {
-            result = SDP_RESULT_OUT_OF_MEMORY;
+            digit = ( uint64_t ) ( pBuffer[ versionEnd ] - '0' );
+
+            if( version > ( ( UINT64_MAX - digit ) / 10U ) )
+            {
+                break;
+            }
+
+            version = ( version * 10U ) + digit;
         }
-        else
+
+        if( ( spaceCount < 2U ) ||
+            ( versionEnd == versionStart ) ||
+            ( versionEnd >= lineEnd ) ||
+            ( pBuffer[ versionEnd ] != ' ' ) )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            result = SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION;
         }
     }
 
-    return result;
-}
-/*-----------------------------------------------------------*/
-
-SdpResult_t SdpSerializer_AddMedia( SdpSerializerContext_t * pCtx,
-                                    uint8_t type,
-                                    const SdpMedia_t * pMedia )
-{
-    int snprintfRetVal;
-    SdpResult_t result = SDP_RESULT_OK;
-    size_t remainingLength = 0;
-    char * pWriteBuffer = NULL;
-
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pMedia == NULL ) ||
-        ( pMedia->pProtocol == NULL ) ||
-        ( pMedia->pFmt == NULL ) )
+    if( result == SDP_RESULT_OK )
     {
-        result = SDP_RESULT_BAD_PARAM;
+        if( increment != 0U )
+        {
+            if( version == UINT64_MAX )
+            {
+                result = SDP_RESULT_BAD_PARAM;
+            }
+            else
+            {
+                sessionVersion = version + 1U;
+            }
+        }
     }
 
     if( result == SDP_RESULT_OK )
     {
-        if( pCtx->pStart != NULL )
-        {
-            pWriteBuffer = &( pCtx->pStart[ pCtx->currentIndex ] );
-            remainingLength = pCtx->totalLength - pCtx->currentIndex;
-        }
+        oldWidth = versionEnd - versionStart;
+        digits = CountDigits( sessionVersion );
+        newWidth = ( digits > minimumDigits ) ? digits : minimumDigits;
 
-        if( pMedia->portNum != 0 )
-        {
-            snprintfRetVal = snprintf( pWriteBuffer,
-                                       remainingLength,
-                                       "%c"
-                                       "=%.*s"
-                                       " %" SDP_PRINT_FMT_UINT16
-                                       "/%" SDP_PRINT_FMT_UINT16
-                                       " %.*s"
-                                       " %.*s\r\n",
-                                       type,
-                                       ( int ) pMedia->mediaLength, pMedia->pMedia,
-                                       pMedia->port,
-                                       pMedia->portNum,
-                                       ( int ) pMedia->protocolLength, pMedia->pProtocol,
-                                       ( int ) pMedia->fmtLength, pMedia->pFmt );
-        }
-        else
+        /* A shorter version is padded to the current width, so the field
+         * never shrinks and the tail only moves when it grows. */
+        if( oldWidth > newWidth )
         {
-            snprintfRetVal = snprintf( pWriteBuffer,
-                                       remainingLength,
-                                       "%c"
-                                       "=%.*s"
-                                       " %" SDP_PRINT_FMT_UINT16
-                                       " %.*s"
-                                       " %.*s\r\n",
-                                       type,
-                                       ( int ) pMedia->mediaLength, pMedia->pMedia,
-                                       pMedia->port,
-                                       ( int ) pMedia->protocolLength, pMedia->pProtocol,
-                                       ( int ) pMedia->fmtLength, pMedia->pFmt );
+            newWidth = oldWidth;
         }
 
-        /* LCOV_EXCL_START */
-        if( snprintfRetVal < 0 )
+        /* Keep room for the NULL terminator. */
+        if( ( newWidth > oldWidth ) && ( ( newWidth - oldWidth ) >= ( bufferLength - messageLength ) ) )
         {
-            result = SDP_RESULT_SNPRINTF_ERROR;
+            result = SDP_RESULT_OUT_OF_MEMORY;
         }
-        /* LCOV_EXCL_STOP  */
-        else if( ( pWriteBuffer != NULL ) && ( ( size_t ) snprintfRetVal >= remainingLength ) )
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        if( newWidth != oldWidth )
         {
-            result = SDP_RESULT_OUT_OF_MEMORY;
+            ( void ) memmove( &( pBuffer[ versionStart + newWidth ] ),
+                              &( pBuffer[ versionEnd ] ),
+                              messageLength - versionEnd );
+            messageLength = messageLength - oldWidth + newWidth;
         }
-        else
+
+        ( void ) memset( &( pBuffer[ versionStart ] ), '0', newWidth - digits );
+        ( void ) FormatUnsignedInteger( &( pBuffer[ versionStart + newWidth - digits ] ), sessionVersion );
+        pBuffer[ messageLength ] = '\0';
+        *pMessageLength = messageLength;
+
+        if( pSessionVersion != NULL )
         {
-            pCtx->currentIndex += ( size_t ) snprintfRetVal;
+            *pSessionVersion = sessionVersion;
         }
     }
 
@@ -554,27 +1543,22 @@ SdpResult_t SdpSerializer_AddMedia( SdpSerializerContext_t * pCtx,
 }
 /*-----------------------------------------------------------*/
 
-SdpResult_t SdpSerializer_Finalize( SdpSerializerContext_t * pCtx,
-                                    const char ** pSdpMessage,
-                                    size_t * pSdpMessageLength )
+SdpResult_t SdpSerializer_SetSessionVersion( char * pBuffer,
+                                             size_t bufferLength,
+                                             size_t * pMessageLength,
+                                             uint64_t sessionVersion,
+                                             size_t minimumDigits )
 {
-    SdpResult_t result = SDP_RESULT_OK;
-
-    if( ( pCtx == NULL ) ||
-        ( ( pCtx->pStart != NULL ) &&
-          ( pCtx->currentIndex > pCtx->totalLength ) ) ||
-        ( pSdpMessage == NULL ) ||
-        ( pSdpMessageLength == NULL ) )
-    {
-        result = SDP_RESULT_BAD_PARAM;
-    }
-
-    if( result == SDP_RESULT_OK )
-    {
-        *pSdpMessage = pCtx->pStart;
-        *pSdpMessageLength = pCtx->currentIndex;
-    }
+    return RewriteSessionVersion( pBuffer, bufferLength, pMessageLength, 0U, sessionVersion, minimumDigits, NULL );
+}
+/*-----------------------------------------------------------*/
 
-    return result;
+SdpResult_t SdpSerializer_IncrementSessionVersion( char * pBuffer,
+                                                   size_t bufferLength,
+                                                   size_t * pMessageLength,
+                                                   size_t minimumDigits,
+                                                   uint64_t * pSessionVersion )
+{
+    return RewriteSessionVersion( pBuffer, bufferLength, pMessageLength, 1U, 0U, minimumDigits, pSessionVersion );
 }
 /*-----------------------------------------------------------*/
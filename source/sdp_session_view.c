@@ -0,0 +1,369 @@
+/* Standard includes. */
+#include <string.h>
+
+/* Interface includes. */
+#include "sdp_session_view.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Bits of parsedFlags.
+ */
+#define SDP_SESSION_VIEW_PARSED_ORIGINATOR    ( 0x01U )
+#define SDP_SESSION_VIEW_PARSED_MEDIA         ( 0x02U )
+#define SDP_SESSION_VIEW_PARSED_ATTRIBUTES    ( 0x04U )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Get the section of a media index.
+ *
+ * @param[in] pView The view.
+ * @param[in] mediaIndex Media index or SDP_SESSION_VIEW_SESSION_LEVEL.
+ * @param[out] ppSection The section.
+ *
+ * @return SDP_RESULT_OK, or SDP_RESULT_BAD_PARAM if the index is out of range.
+ */
+static SdpResult_t GetSection( const SdpSessionView_t * pView,
+                               size_t mediaIndex,
+                               SdpSessionViewSection_t ** ppSection );
+
+/**
+ * @brief Parse every attribute line of a section into arrays carved from the
+ * arena of the view.
+ *
+ * @param[in] pView The view.
+ * @param[in,out] pSection The section.
+ *
+ * @return SDP_RESULT_OK on success, or the error of the arena or the parser.
+ */
+static SdpResult_t ParseSectionAttributes( const SdpSessionView_t * pView,
+                                           SdpSessionViewSection_t * pSection );
+
+/*-----------------------------------------------------------*/
+
+static SdpResult_t GetSection( const SdpSessionView_t * pView,
+                               size_t mediaIndex,
+                               SdpSessionViewSection_t ** ppSection )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( mediaIndex == SDP_SESSION_VIEW_SESSION_LEVEL )
+    {
+        *ppSection = &( pView->pSections[ 0 ] );
+    }
+    else if( mediaIndex < pView->mediaCount )
+    {
+        *ppSection = &( pView->pSections[ mediaIndex + 1U ] );
+    }
+    else
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+static SdpResult_t ParseSectionAttributes( const SdpSessionView_t * pView,
+                                           SdpSessionViewSection_t * pSection )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    const SdpLineInfo_t * pLine;
+    size_t attributeCount = 0, i;
+    void * pMemory;
+
+    for( i = 0; i < pSection->lineCount; i++ )
+    {
+        if( pView->pLines[ pSection->firstLine + i ].type == SDP_TYPE_ATTRIBUTE )
+        {
+            attributeCount++;
+        }
+    }
+
+    /* Arrays left by a failed earlier call are reused, so a retry does not
+     * take more space from the arena. */
+    if( ( attributeCount > 0U ) && ( pSection->pAttributes == NULL ) )
+    {
+        result = SdpArena_Allocate( pView->pArena, attributeCount * sizeof( SdpAttribute_t ), &( pMemory ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            pSection->pAttributes = ( SdpAttribute_t * ) pMemory;
+        }
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( attributeCount > 0U ) && ( pSection->pAttributeKinds == NULL ) )
+    {
+        result = SdpArena_Allocate( pView->pArena, attributeCount * sizeof( SdpAttributeKind_t ), &( pMemory ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            pSection->pAttributeKinds = ( SdpAttributeKind_t * ) pMemory;
+        }
+    }
+
+    pSection->attributeCount = 0;
+
+    for( i = 0; ( result == SDP_RESULT_OK ) && ( i < pSection->lineCount ); i++ )
+    {
+        pLine = &( pView->pLines[ pSection->firstLine + i ] );
+
+        if( pLine->type == SDP_TYPE_ATTRIBUTE )
+        {
+            result = SdpDeserializer_ParseAttributeWithKind( &( pView->pStart[ pLine->valueOffset ] ),
+                                                             pLine->valueLength,
+                                                             &( pSection->pAttributes[ pSection->attributeCount ] ),
+                                                             &( pSection->pAttributeKinds[ pSection->attributeCount ] ) );
+            pSection->attributeCount++;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pSection->parsedFlags |= SDP_SESSION_VIEW_PARSED_ATTRIBUTES;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSessionView_Init( SdpSessionView_t * pView,
+                                 const SdpDeserializerContext_t * pCtx,
+                                 SdpArena_t * pArena )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    size_t lineCount = 0, mediaCount = 0, sectionIndex = 0, i;
+    void * pMemory;
+
+    if( ( pView == NULL ) ||
+        ( pCtx == NULL ) ||
+        ( pArena == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        ( void ) memset( pView, 0, sizeof( SdpSessionView_t ) );
+        pView->pStart = pCtx->pStart;
+        pView->pArena = pArena;
+
+        result = SdpDeserializer_IndexLines( pCtx, NULL, 0, &( lineCount ) );
+    }
+
+    if( ( result == SDP_RESULT_OK ) && ( lineCount > 0U ) )
+    {
+        result = SdpArena_Allocate( pArena, lineCount * sizeof( SdpLineInfo_t ), &( pMemory ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            pView->pLines = ( SdpLineInfo_t * ) pMemory;
+            result = SdpDeserializer_IndexLines( pCtx, pView->pLines, lineCount, &( pView->lineCount ) );
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < pView->lineCount; i++ )
+        {
+            if( pView->pLines[ i ].type == SDP_TYPE_MEDIA )
+            {
+                mediaCount++;
+            }
+        }
+
+        result = SdpArena_Allocate( pArena, ( mediaCount + 1U ) * sizeof( SdpSessionViewSection_t ), &( pMemory ) );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        pView->pSections = ( SdpSessionViewSection_t * ) pMemory;
+        pView->mediaCount = mediaCount;
+        ( void ) memset( pView->pSections, 0, ( mediaCount + 1U ) * sizeof( SdpSessionViewSection_t ) );
+
+        /* Every "m=" line starts the next section. */
+        for( i = 0; i < pView->lineCount; i++ )
+        {
+            if( pView->pLines[ i ].type == SDP_TYPE_MEDIA )
+            {
+                sectionIndex++;
+                pView->pSections[ sectionIndex ].firstLine = i;
+            }
+
+            pView->pSections[ sectionIndex ].lineCount++;
+        }
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSessionView_GetOriginator( SdpSessionView_t * pView,
+                                          const SdpOriginator_t ** ppOriginator )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    const SdpLineInfo_t * pLine = NULL;
+    size_t i;
+
+    if( ( pView == NULL ) ||
+        ( pView->pSections == NULL ) ||
+        ( ppOriginator == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == SDP_RESULT_OK ) &&
+        ( ( pView->parsedFlags & SDP_SESSION_VIEW_PARSED_ORIGINATOR ) == 0U ) )
+    {
+        for( i = 0; i < pView->pSections[ 0 ].lineCount; i++ )
+        {
+            if( pView->pLines[ i ].type == SDP_TYPE_ORIGINATOR )
+            {
+                pLine = &( pView->pLines[ i ] );
+                break;
+            }
+        }
+
+        if( pLine == NULL )
+        {
+            result = SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO;
+        }
+        else
+        {
+            result = SdpDeserializer_ParseOriginator( &( pView->pStart[ pLine->valueOffset ] ),
+                                                      pLine->valueLength,
+                                                      &( pView->originator ) );
+        }
+
+        if( result == SDP_RESULT_OK )
+        {
+            pView->parsedFlags |= SDP_SESSION_VIEW_PARSED_ORIGINATOR;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *ppOriginator = &( pView->originator );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSessionView_GetMediaCount( const SdpSessionView_t * pView,
+                                          size_t * pMediaCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+
+    if( ( pView == NULL ) ||
+        ( pMediaCount == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        *pMediaCount = pView->mediaCount;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSessionView_GetMedia( SdpSessionView_t * pView,
+                                     size_t mediaIndex,
+                                     const SdpMedia_t ** ppMedia )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpSessionViewSection_t * pSection = NULL;
+    const SdpLineInfo_t * pLine;
+
+    if( ( pView == NULL ) ||
+        ( pView->pSections == NULL ) ||
+        ( mediaIndex == SDP_SESSION_VIEW_SESSION_LEVEL ) ||
+        ( ppMedia == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = GetSection( pView, mediaIndex, &( pSection ) );
+    }
+
+    if( ( result == SDP_RESULT_OK ) &&
+        ( ( pSection->parsedFlags & SDP_SESSION_VIEW_PARSED_MEDIA ) == 0U ) )
+    {
+        pLine = &( pView->pLines[ pSection->firstLine ] );
+        result = SdpDeserializer_ParseMedia( &( pView->pStart[ pLine->valueOffset ] ),
+                                             pLine->valueLength,
+                                             &( pSection->media ) );
+
+        if( result == SDP_RESULT_OK )
+        {
+            pSection->parsedFlags |= SDP_SESSION_VIEW_PARSED_MEDIA;
+        }
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        *ppMedia = &( pSection->media );
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
+
+SdpResult_t SdpSessionView_GetAttributes( SdpSessionView_t * pView,
+                                          size_t mediaIndex,
+                                          SdpAttributeKind_t kind,
+                                          SdpAttribute_t * pAttributes,
+                                          size_t maxAttributes,
+                                          size_t * pAttributeCount )
+{
+    SdpResult_t result = SDP_RESULT_OK;
+    SdpSessionViewSection_t * pSection = NULL;
+    size_t attributeCount = 0, i;
+
+    if( ( pView == NULL ) ||
+        ( pView->pSections == NULL ) ||
+        ( pAttributeCount == NULL ) )
+    {
+        result = SDP_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = GetSection( pView, mediaIndex, &( pSection ) );
+    }
+
+    if( ( result == SDP_RESULT_OK ) &&
+        ( ( pSection->parsedFlags & SDP_SESSION_VIEW_PARSED_ATTRIBUTES ) == 0U ) )
+    {
+        result = ParseSectionAttributes( pView, pSection );
+    }
+
+    if( result == SDP_RESULT_OK )
+    {
+        for( i = 0; i < pSection->attributeCount; i++ )
+        {
+            if( pSection->pAttributeKinds[ i ] == kind )
+            {
+                if( ( pAttributes != NULL ) && ( attributeCount < maxAttributes ) )
+                {
+                    pAttributes[ attributeCount ] = pSection->pAttributes[ i ];
+                }
+
+                attributeCount++;
+            }
+        }
+
+        if( ( pAttributes != NULL ) && ( attributeCount > maxAttributes ) )
+        {
+            result = SDP_RESULT_OUT_OF_MEMORY;
+        }
+
+        *pAttributeCount = attributeCount;
+    }
+
+    return result;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,318 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+#include "sdp_arena.h"
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SDP_TEST_BUFFER_SIZE ( 64 )
+
+SdpArena_t arena;
+uint64_t arenaBuffer[ SDP_TEST_BUFFER_SIZE / sizeof( uint64_t ) ];
+uint64_t growBuffer[ 4 ][ SDP_TEST_BUFFER_SIZE ];
+size_t growCount;
+size_t growLengths[ 4 ];
+
+void setUp( void )
+{
+    memset( &( arena ), 0, sizeof( arena ) );
+    memset( &( arenaBuffer[ 0 ] ), 0, sizeof( arenaBuffer ) );
+    growCount = 0;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief Grow callback that hands out the blocks in growBuffer.
+ */
+static void * GrowFromTestBlocks( void * pGrowContext,
+                                  size_t blockLength )
+{
+    void * pBlock = NULL;
+    size_t maxBlocks = *( ( size_t * ) pGrowContext );
+
+    if( ( growCount < maxBlocks ) && ( blockLength <= sizeof( growBuffer[ 0 ] ) ) )
+    {
+        growLengths[ growCount ] = blockLength;
+        pBlock = &( growBuffer[ growCount ][ 0 ] );
+        growCount++;
+    }
+
+    return pBlock;
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Inputs are valid.
+ */
+void test_SdpArena_Init_Pass( void )
+{
+    SdpResult_t result;
+    size_t growContext = 0;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), GrowFromTestBlocks, &( growContext ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), arena.pBuffer );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), arena.pInitialBuffer );
+    TEST_ASSERT_EQUAL( sizeof( arenaBuffer ), arena.bufferLength );
+    TEST_ASSERT_EQUAL( sizeof( arenaBuffer ), arena.initialBufferLength );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+    TEST_ASSERT_EQUAL_PTR( GrowFromTestBlocks, arena.growCallback );
+    TEST_ASSERT_EQUAL_PTR( &( growContext ), arena.pGrowContext );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Arena is NULL, or the buffer is NULL with a non-zero length.
+ */
+void test_SdpArena_Init_BadParams( void )
+{
+    SdpResult_t result;
+
+    result = SdpArena_Init( NULL, &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpArena_Init( &( arena ), NULL, sizeof( arenaBuffer ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief No buffer is given, so the static region from the config is used.
+ */
+void test_SdpArena_Init_StaticBuffer( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+
+    result = SdpArena_Init( &( arena ), NULL, 0, NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_NOT_NULL( arena.pBuffer );
+    TEST_ASSERT_EQUAL( SDP_ARENA_STATIC_BUFFER_SIZE, arena.bufferLength );
+
+    result = SdpArena_Allocate( &( arena ), SDP_ARENA_STATIC_BUFFER_SIZE, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( arena.pBuffer, pMemory );
+
+    result = SdpArena_Allocate( &( arena ), 1, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Allocations are consecutive and aligned.
+ */
+void test_SdpArena_Allocate_Pass( void )
+{
+    SdpResult_t result;
+    void * pFirst = NULL;
+    void * pSecond = NULL;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( &( arena ), 3, &( pFirst ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), pFirst );
+    TEST_ASSERT_EQUAL( 3, arena.used );
+
+    result = SdpArena_Allocate( &( arena ), 8, &( pSecond ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( ( uint8_t * ) &( arenaBuffer[ 0 ] ) + SDP_ARENA_ALIGNMENT, pSecond );
+    TEST_ASSERT_EQUAL( 0, ( uintptr_t ) pSecond % SDP_ARENA_ALIGNMENT );
+    TEST_ASSERT_EQUAL( SDP_ARENA_ALIGNMENT + 8, arena.used );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Arena is NULL, size is 0 or output is NULL.
+ */
+void test_SdpArena_Allocate_BadParams( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( NULL, 1, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpArena_Allocate( &( arena ), 0, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpArena_Allocate( &( arena ), 1, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Buffer is exhausted and there is no grow callback.
+ */
+void test_SdpArena_Allocate_OutOfMemory( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ) - 1, NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( &( arena ), sizeof( arenaBuffer ), &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    result = SdpArena_Allocate( &( arena ), sizeof( arenaBuffer ) - 3, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    /* The padding alone does not fit. */
+    result = SdpArena_Allocate( &( arena ), 1, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( sizeof( arenaBuffer ) - 3, arena.used );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The grow callback provides new blocks that keep getting larger.
+ */
+void test_SdpArena_Allocate_Grow( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+    size_t growContext = 3;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), 16, GrowFromTestBlocks, &( growContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( &( arena ), 16, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), pMemory );
+
+    result = SdpArena_Allocate( &( arena ), 10, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, growCount );
+    TEST_ASSERT_EQUAL( 2 * 16, growLengths[ 0 ] );
+    TEST_ASSERT_EQUAL_PTR( &( growBuffer[ 0 ][ 0 ] ), pMemory );
+
+    result = SdpArena_Allocate( &( arena ), growLengths[ 0 ], &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, growCount );
+    TEST_ASSERT_EQUAL( 2 * growLengths[ 0 ], growLengths[ 1 ] );
+    TEST_ASSERT_EQUAL_PTR( &( growBuffer[ 1 ][ 0 ] ), pMemory );
+
+    /* A request larger than twice the block gets a block of its own size. */
+    result = SdpArena_Allocate( &( arena ), 5 * growLengths[ 0 ], &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, growCount );
+    TEST_ASSERT_EQUAL( 5 * growLengths[ 0 ] + SDP_ARENA_ALIGNMENT - 1, growLengths[ 2 ] );
+
+    /* The callback has no more blocks. */
+    result = SdpArena_Allocate( &( arena ), sizeof( growBuffer[ 0 ] ), &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Growing the arena would overflow the block length.
+ */
+void test_SdpArena_Allocate_GrowOverflow( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+    size_t growContext = 1;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), GrowFromTestBlocks, &( growContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( &( arena ), SIZE_MAX - SDP_ARENA_ALIGNMENT, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    /* The block length itself is already too large to grow from. */
+    arena.bufferLength = SIZE_MAX;
+    arena.used = SIZE_MAX - 1;
+    result = SdpArena_Allocate( &( arena ), 8, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 0, growCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief An arena without an initial buffer allocates from grown blocks only.
+ */
+void test_SdpArena_Allocate_NoInitialBuffer( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+    size_t growContext = 1;
+
+    arena.pInitialBuffer = NULL;
+    arena.initialBufferLength = 0;
+    arena.pBuffer = NULL;
+    arena.bufferLength = 0;
+    arena.growCallback = GrowFromTestBlocks;
+    arena.pGrowContext = &( growContext );
+
+    result = SdpArena_Allocate( &( arena ), 4, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( growBuffer[ 0 ][ 0 ] ), pMemory );
+    TEST_ASSERT_EQUAL( 4 + SDP_ARENA_ALIGNMENT - 1, growLengths[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Reset returns to the initial buffer.
+ */
+void test_SdpArena_Reset_Pass( void )
+{
+    SdpResult_t result;
+    void * pMemory = NULL;
+    size_t growContext = 1;
+
+    result = SdpArena_Init( &( arena ), &( arenaBuffer[ 0 ] ), sizeof( arenaBuffer ), GrowFromTestBlocks, &( growContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpArena_Allocate( &( arena ), sizeof( arenaBuffer ) + 1, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( growBuffer[ 0 ][ 0 ] ), arena.pBuffer );
+
+    result = SdpArena_Reset( &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), arena.pBuffer );
+    TEST_ASSERT_EQUAL( sizeof( arenaBuffer ), arena.bufferLength );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+
+    result = SdpArena_Allocate( &( arena ), 1, &( pMemory ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaBuffer[ 0 ] ), pMemory );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Arena is NULL.
+ */
+void test_SdpArena_Reset_NullArena( void )
+{
+    SdpResult_t result;
+
+    result = SdpArena_Reset( NULL );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
@@ -24,4 +24,11 @@
     #define SDP_PRINT_FMT_UINT16        "hu"
 #endif
 
+/**
+ * @brief Static arena region used by the unit tests.
+ */
+#ifndef SDP_ARENA_STATIC_BUFFER_SIZE
+    #define SDP_ARENA_STATIC_BUFFER_SIZE    256
+#endif
+
 #endif /* SDP_CONFIG_H */
@@ -3,6 +3,7 @@
 #include "catch_assert.h"
 
 /* Standard includes. */
+#include <stdio.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -366,6 +367,274 @@ void test_SdpDeserializer_GetNext_Pass_r( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Lines longer than a vector width with both '\r\n' and '\n' endings.
+ */
+void test_SdpDeserializer_GetNext_Pass_LongLines( void )
+{
+    SdpResult_t result;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+    char buffer[] = "a=candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host generation 0\r\n"
+                    "a=ice-ufrag:F7gI\n"
+                    "a=fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2\n";
+    size_t inputLength = strlen( buffer );
+    char expectCandidate[] = "candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host generation 0";
+    char expectUfrag[] = "ice-ufrag:F7gI";
+    char expectFingerprint[] = "fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2";
+
+    /* Initialize serializer context. */
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = inputLength;
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, type );
+    TEST_ASSERT_EQUAL( strlen( expectCandidate ), valueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( expectCandidate, pValue, valueLength );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, type );
+    TEST_ASSERT_EQUAL( strlen( expectUfrag ), valueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( expectUfrag, pValue, valueLength );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, type );
+    TEST_ASSERT_EQUAL( strlen( expectFingerprint ), valueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( expectFingerprint, pValue, valueLength );
+    TEST_ASSERT_EQUAL( inputLength, deserializerContext.currentIndex );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A line longer than a vector width without '\n'.
+ */
+void test_SdpDeserializer_GetNext_LongLine_Incorrect_End( void )
+{
+    SdpResult_t result;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+    char buffer[] = "a=candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host generation 0\r";
+    size_t inputLength = strlen( buffer );
+
+    /* Initialize serializer context. */
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = inputLength;
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND, result );
+    TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SDP Deserializer Index Lines fail functionality for Bad Parameters.
+ */
+void test_SdpDeserializer_IndexLines_BadParams( void )
+{
+    SdpResult_t result;
+    SdpLineInfo_t lines[ 2 ];
+    size_t lineCount;
+    char buffer[] = "v=0\r\n";
+
+    result = SdpDeserializer_IndexLines( NULL, lines, 2, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* pStart is NULL. */
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 2, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = strlen( buffer );
+    deserializerContext.currentIndex = deserializerContext.totalLength + 1;
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 2, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 2, NULL );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief All lines, with '\r\n' and '\n' endings and spanning several blocks, are indexed.
+ */
+void test_SdpDeserializer_IndexLines_Pass( void )
+{
+    SdpResult_t result;
+    SdpLineInfo_t lines[ 8 ];
+    size_t lineCount;
+    char buffer[] = "v=0\r\n"
+                    "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+                    "s=-\n"
+                    "a=candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host generation 0\r\n"
+                    "a=fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2\n"
+                    "a=rtcp-mux\r\n";
+    size_t inputLength = strlen( buffer );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, inputLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 8, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 6, lineCount );
+    TEST_ASSERT_EQUAL( SDP_TYPE_VERSION, lines[ 0 ].type );
+    TEST_ASSERT_EQUAL( 2, lines[ 0 ].valueOffset );
+    TEST_ASSERT_EQUAL( 1, lines[ 0 ].valueLength );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ORIGINATOR, lines[ 1 ].type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "- 4611731400430051336 2 IN IP4 127.0.0.1", &( buffer[ lines[ 1 ].valueOffset ] ), lines[ 1 ].valueLength );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, lines[ 2 ].type );
+    TEST_ASSERT_EQUAL( 1, lines[ 2 ].valueLength );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, lines[ 3 ].type );
+    TEST_ASSERT_EQUAL( strlen( "candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host generation 0" ), lines[ 3 ].valueLength );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, lines[ 4 ].type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "fingerprint:sha-256 19:E2", &( buffer[ lines[ 4 ].valueOffset ] ), 25 );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, lines[ 5 ].type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "rtcp-mux", &( buffer[ lines[ 5 ].valueOffset ] ), lines[ 5 ].valueLength );
+    TEST_ASSERT_EQUAL( strlen( "rtcp-mux" ), lines[ 5 ].valueLength );
+
+    /* The context is not moved. */
+    TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Only the lines after the current position are indexed.
+ */
+void test_SdpDeserializer_IndexLines_PassFromCurrentIndex( void )
+{
+    SdpResult_t result;
+    SdpLineInfo_t lines[ 2 ];
+    size_t lineCount;
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+    char buffer[] = "v=0\r\ns=-\r\n";
+
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = strlen( buffer );
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 2, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, lineCount );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, lines[ 0 ].type );
+    TEST_ASSERT_EQUAL( 7, lines[ 0 ].valueOffset );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Lines are counted when no array is provided, and OUT_OF_MEMORY is
+ * returned when the array is too small.
+ */
+void test_SdpDeserializer_IndexLines_CountAndOutOfMemory( void )
+{
+    SdpResult_t result;
+    SdpLineInfo_t lines[ 2 ];
+    size_t lineCount;
+    char buffer[] = "v=0\r\ns=-\r\nt=0 0\r\n";
+
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = strlen( buffer );
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), NULL, 0, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, lineCount );
+
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 2, &( lineCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 3, lineCount );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, lines[ 1 ].type );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Malformed lines are reported with the same results as SdpDeserializer_GetNext.
+ */
+void test_SdpDeserializer_IndexLines_Malformed( void )
+{
+    SdpResult_t result;
+    SdpLineInfo_t lines[ 4 ];
+    size_t lineCount;
+    char noEqual[] = "v=0\r\nsx-\r\n";
+    char noValue[] = "v=0\r\ns=\r\n";
+    char noNewline[] = "v=0\r\ns=-";
+    char noEqualAtEnd[] = "v=0\r\nsx-";
+    char notEnoughInfo[] = "v=0\r\ns=";
+    char newlineAsType[] = "\n=0\r\n";
+
+    deserializerContext.pStart = noEqual;
+    deserializerContext.totalLength = strlen( noEqual );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND, result );
+    TEST_ASSERT_EQUAL( 1, lineCount );
+
+    deserializerContext.pStart = noValue;
+    deserializerContext.totalLength = strlen( noValue );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE, result );
+    TEST_ASSERT_EQUAL( 1, lineCount );
+
+    deserializerContext.pStart = noNewline;
+    deserializerContext.totalLength = strlen( noNewline );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND, result );
+
+    deserializerContext.pStart = noEqualAtEnd;
+    deserializerContext.totalLength = strlen( noEqualAtEnd );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND, result );
+
+    deserializerContext.pStart = notEnoughInfo;
+    deserializerContext.totalLength = strlen( notEnoughInfo );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+
+    /* A '\n' in place of the type does not end the line. */
+    deserializerContext.pStart = newlineAsType;
+    deserializerContext.totalLength = strlen( newlineAsType );
+    result = SdpDeserializer_IndexLines( &( deserializerContext ), lines, 4, &( lineCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, lineCount );
+    TEST_ASSERT_EQUAL( '\n', lines[ 0 ].type );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate SDP Deserializer Parse Originator fail functionality for Bad Parameters.
  */
@@ -515,6 +784,76 @@ void test_SdpDeserializer_ParseOriginator_Pass( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief The message is valid with the largest session ID and version.
+ */
+void test_SdpDeserializer_ParseOriginator_PassMaxValues( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="- 18446744073709551615 0018446744073709551615 IN IP4 127.0.0.1";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpOriginator_t originator;
+
+    result = SdpDeserializer_ParseOriginator( originatorBuffer, inputLength, &( originator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( UINT64_MAX, originator.sessionId );
+    TEST_ASSERT_EQUAL( UINT64_MAX, originator.sessionVersion );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The session ID does not fit in 64 bits.
+ */
+void test_SdpDeserializer_ParseOriginator_SessionIdOverflow( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="- 18446744073709551616 1 IN IP4 127.0.0.1";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpOriginator_t originator;
+
+    result = SdpDeserializer_ParseOriginator( originatorBuffer, inputLength, &( originator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_ID, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The session version has more than 20 digits.
+ */
+void test_SdpDeserializer_ParseOriginator_SessionVersionOverflow( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="- 1 999999999999999999999999 IN IP4 127.0.0.1";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpOriginator_t originator;
+
+    result = SdpDeserializer_ParseOriginator( originatorBuffer, inputLength, &( originator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The session ID contains a non-digit character.
+ */
+void test_SdpDeserializer_ParseOriginator_SessionIdNotDigits( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="- 1234567a9 1 IN IP4 127.0.0.1";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpOriginator_t originator;
+
+    result = SdpDeserializer_ParseOriginator( originatorBuffer, inputLength, &( originator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_ID, result );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate SDP Deserializer Parse Connection Info fail functionality for Bad Parameters.
  */
@@ -757,6 +1096,41 @@ void test_SdpDeserializer_ParseBandwidthInfo_Pass( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief The bandwidth value contains a non-digit character.
+ */
+void test_SdpDeserializer_ParseBandwidthInfo_InvalidBandwidthValue( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="AS:12x";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpBandwidthInfo_t bandwidth;
+
+    result = SdpDeserializer_ParseBandwidthInfo( originatorBuffer, inputLength, &( bandwidth ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_BANDWIDTH, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The bandwidth value is not followed by a NULL terminator.
+ */
+void test_SdpDeserializer_ParseBandwidthInfo_PassNotNullTerminated( void )
+{
+    SdpResult_t result;
+    char originatorBuffer[] ="AS:128\r\n";
+    size_t inputLength = strlen( "AS:128" );
+    SdpBandwidthInfo_t bandwidth;
+
+    result = SdpDeserializer_ParseBandwidthInfo( originatorBuffer, inputLength - 1, &( bandwidth ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 12, bandwidth.sdpBandwidthValue );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate SDP Deserializer Parse Time Active fail functionality for Bad Parameters.
  */
@@ -848,39 +1222,75 @@ void test_SdpDeserializer_ParseTimeActive_Pass( void )
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Validate SDP Deserializer Parse Attribute fail functionality for Bad Parameters.
+ * @brief The start time is negative.
  */
-void test_SdpDeserializer_ParseAttribute_BadParams( void )
+void test_SdpDeserializer_ParseTimeActive_NegativeStartTime( void )
 {
     SdpResult_t result;
-    char attributeString[] = "rtpmap:126 telephone-event/8000";
-    size_t attributeStringLength = strlen( attributeString );
-    SdpAttribute_t attribute;
-
-    memset( &( attribute ), 0, sizeof( SdpAttribute_t ) );
-
-    result = SdpDeserializer_ParseAttribute( NULL, 0, &( attribute ) );
-
-    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+    char originatorBuffer[] ="-1 0";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpTimeDescription_t timeDescription;
 
-    result = SdpDeserializer_ParseAttribute( attributeString, attributeStringLength, NULL );
+    result = SdpDeserializer_ParseTimeActive( originatorBuffer, inputLength, &( timeDescription ) );
 
-    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_START_TIME, result );
 }
 
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Inputs are valid.
+ * @brief Only the given length of the value is parsed.
  */
-void test_SdpDeserializer_ParseAttribute_Pass( void )
+void test_SdpDeserializer_ParseTimeActive_PassNotNullTerminated( void )
 {
     SdpResult_t result;
-    char attributeString[] = "rtpmap:126 telephone-event/8000";
-    size_t attributeStringLength = strlen( attributeString );
-    char expectAttributeName[] = "rtpmap";
-    size_t expectAttributeNameLength = strlen( expectAttributeName );
-    char expectAttributeValue[] = "126 telephone-event/8000";
+    char originatorBuffer[] ="3034423619 3042462419";
+    size_t inputLength = strlen( originatorBuffer );
+    SdpTimeDescription_t timeDescription;
+
+    result = SdpDeserializer_ParseTimeActive( originatorBuffer, inputLength - 5, &( timeDescription ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3034423619, timeDescription.startTime );
+    TEST_ASSERT_EQUAL( 30424, timeDescription.stopTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SDP Deserializer Parse Attribute fail functionality for Bad Parameters.
+ */
+void test_SdpDeserializer_ParseAttribute_BadParams( void )
+{
+    SdpResult_t result;
+    char attributeString[] = "rtpmap:126 telephone-event/8000";
+    size_t attributeStringLength = strlen( attributeString );
+    SdpAttribute_t attribute;
+
+    memset( &( attribute ), 0, sizeof( SdpAttribute_t ) );
+
+    result = SdpDeserializer_ParseAttribute( NULL, 0, &( attribute ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseAttribute( attributeString, attributeStringLength, NULL );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Inputs are valid.
+ */
+void test_SdpDeserializer_ParseAttribute_Pass( void )
+{
+    SdpResult_t result;
+    char attributeString[] = "rtpmap:126 telephone-event/8000";
+    size_t attributeStringLength = strlen( attributeString );
+    char expectAttributeName[] = "rtpmap";
+    size_t expectAttributeNameLength = strlen( expectAttributeName );
+    char expectAttributeValue[] = "126 telephone-event/8000";
     size_t expectAttributeValueLength = strlen( expectAttributeValue );
     SdpAttribute_t attribute;
 
@@ -1055,6 +1465,45 @@ void test_SdpDeserializer_ParseMedia_InvalidPortNum( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Port does not fit in 16 bits.
+ */
+void test_SdpDeserializer_ParseMedia_PortOverflow( void )
+{
+    SdpResult_t result;
+    char mediaString[] = "audio 65536 UDP/TLS/RTP/SAVPF 111";
+    size_t mediaStringLength = strlen( mediaString );
+    SdpMedia_t media;
+
+    memset( &( media ), 0, sizeof( SdpMedia_t ) );
+
+    result = SdpDeserializer_ParseMedia( mediaString, mediaStringLength, &( media ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORT, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Number of ports does not fit in 16 bits.
+ */
+void test_SdpDeserializer_ParseMedia_PortNumOverflow( void )
+{
+    SdpResult_t result;
+    char mediaString[] = "audio 65535/65536 UDP/TLS/RTP/SAVPF 111";
+    size_t mediaStringLength = strlen( mediaString );
+    SdpMedia_t media;
+
+    memset( &( media ), 0, sizeof( SdpMedia_t ) );
+
+    result = SdpDeserializer_ParseMedia( mediaString, mediaStringLength, &( media ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORTNUM, result );
+    TEST_ASSERT_EQUAL_UINT16( 65535, media.port );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Input media lack format information.
  */
@@ -1073,3 +1522,2736 @@ void test_SdpDeserializer_ParseMedia_InvalidMediaString( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SDP Deserializer Parse Session fail functionality for Bad Parameters.
+ */
+void test_SdpDeserializer_ParseSession_BadParams( void )
+{
+    SdpResult_t result;
+    SdpSessionStorage_t storage;
+    SdpSessionDescription_t session;
+
+    memset( &( storage ), 0, sizeof( storage ) );
+
+    result = SdpDeserializer_ParseSession( NULL, &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), NULL, &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A complete offer is parsed into a session description.
+ */
+void test_SdpDeserializer_ParseSession_Pass( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "i=A session\r\n"
+                    "u=http://www.example.com/seminars/sdp.pdf\r\n"
+                    "c=IN IP4 224.2.17.12\r\n"
+                    "b=AS:256\r\n"
+                    "t=0 0\r\n"
+                    "a=group:BUNDLE 0 1\r\n"
+                    "a=msid-semantic: WMS\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "c=IN IP4 0.0.0.0\r\n"
+                    "a=mid:0\r\n"
+                    "a=rtpmap:111 opus/48000/2\r\n"
+                    "a=sendrecv\r\n"
+                    "m=video 9 UDP/TLS/RTP/SAVPF 96\r\n"
+                    "i=Main camera\r\n"
+                    "c=IN IP6 ::1\r\n"
+                    "b=AS:2000\r\n"
+                    "b=TIAS:2000000\r\n"
+                    "a=mid:1\r\n";
+    SdpSessionStorage_t storage;
+    SdpSessionDescription_t session;
+    SdpMediaDescription_t mediaDescriptions[ 2 ];
+    SdpAttribute_t attributes[ 8 ];
+    SdpConnectionInfo_t connectionInfos[ 3 ];
+    SdpBandwidthInfo_t bandwidthInfos[ 3 ];
+    SdpTimeDescription_t timeDescriptions[ 1 ];
+
+    storage.pMediaDescriptions = mediaDescriptions;
+    storage.mediaDescriptionsLength = 2;
+    storage.pAttributes = attributes;
+    storage.attributesLength = 8;
+    storage.pConnectionInfos = connectionInfos;
+    storage.connectionInfosLength = 3;
+    storage.pBandwidthInfos = bandwidthInfos;
+    storage.bandwidthInfosLength = 3;
+    storage.pTimeDescriptions = timeDescriptions;
+    storage.timeDescriptionsLength = 1;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( buffer ), deserializerContext.currentIndex );
+
+    TEST_ASSERT_EQUAL( 0, session.version );
+    TEST_ASSERT_EQUAL( 4611731400430051336ULL, session.originator.sessionId );
+    TEST_ASSERT_EQUAL( 2, session.originator.sessionVersion );
+    TEST_ASSERT_EQUAL_STRING_LEN( "-", session.pSessionName, session.sessionNameLength );
+    TEST_ASSERT_EQUAL( 1, session.sessionNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "A session", session.pSessionInfo, session.sessionInfoLength );
+    TEST_ASSERT_EQUAL( 9, session.sessionInfoLength );
+    TEST_ASSERT_EQUAL( 1, session.connectionInfoCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "224.2.17.12", session.pConnectionInfos[ 0 ].pAddress, session.pConnectionInfos[ 0 ].addressLength );
+    TEST_ASSERT_EQUAL( 1, session.bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 256, session.pBandwidthInfos[ 0 ].sdpBandwidthValue );
+    TEST_ASSERT_EQUAL( 1, session.timeDescriptionCount );
+    TEST_ASSERT_EQUAL( 2, session.attributeCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "msid-semantic", session.pAttributes[ 1 ].pAttributeName, session.pAttributes[ 1 ].attributeNameLength );
+
+    TEST_ASSERT_EQUAL( 2, session.mediaDescriptionCount );
+
+    TEST_ASSERT_EQUAL_STRING_LEN( "audio", session.pMediaDescriptions[ 0 ].media.pMedia, session.pMediaDescriptions[ 0 ].media.mediaLength );
+    TEST_ASSERT_EQUAL( NULL, session.pMediaDescriptions[ 0 ].pMediaTitle );
+    TEST_ASSERT_EQUAL( 1, session.pMediaDescriptions[ 0 ].connectionInfoCount );
+    TEST_ASSERT_EQUAL( SDP_ADDRESS_IPV4, session.pMediaDescriptions[ 0 ].pConnectionInfos[ 0 ].addressType );
+    TEST_ASSERT_EQUAL( 0, session.pMediaDescriptions[ 0 ].bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 3, session.pMediaDescriptions[ 0 ].attributeCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "mid", session.pMediaDescriptions[ 0 ].pAttributes[ 0 ].pAttributeName, 3 );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", session.pMediaDescriptions[ 0 ].pAttributes[ 0 ].pAttributeValue, 1 );
+    TEST_ASSERT_EQUAL_STRING_LEN( "sendrecv", session.pMediaDescriptions[ 0 ].pAttributes[ 2 ].pAttributeName, 8 );
+
+    TEST_ASSERT_EQUAL_STRING_LEN( "video", session.pMediaDescriptions[ 1 ].media.pMedia, session.pMediaDescriptions[ 1 ].media.mediaLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "Main camera", session.pMediaDescriptions[ 1 ].pMediaTitle, session.pMediaDescriptions[ 1 ].mediaTitleLength );
+    TEST_ASSERT_EQUAL( 1, session.pMediaDescriptions[ 1 ].connectionInfoCount );
+    TEST_ASSERT_EQUAL( SDP_ADDRESS_IPV6, session.pMediaDescriptions[ 1 ].pConnectionInfos[ 0 ].addressType );
+    TEST_ASSERT_EQUAL( 2, session.pMediaDescriptions[ 1 ].bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 2000000, session.pMediaDescriptions[ 1 ].pBandwidthInfos[ 1 ].sdpBandwidthValue );
+    TEST_ASSERT_EQUAL( 1, session.pMediaDescriptions[ 1 ].attributeCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1", session.pMediaDescriptions[ 1 ].pAttributes[ 0 ].pAttributeValue, 1 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Each storage array being too small is reported.
+ */
+void test_SdpDeserializer_ParseSession_OutOfMemory( void )
+{
+    SdpResult_t result;
+    char timeBuffer[] = "v=0\r\nt=0 0\r\n";
+    char connectionBuffer[] = "v=0\r\nc=IN IP4 0.0.0.0\r\n";
+    char bandwidthBuffer[] = "v=0\r\nb=AS:1\r\n";
+    char attributeBuffer[] = "v=0\r\na=ice-lite\r\n";
+    char mediaBuffer[] = "v=0\r\nm=audio 9 RTP/AVP 0\r\n";
+    SdpSessionStorage_t storage;
+    SdpSessionDescription_t session;
+
+    memset( &( storage ), 0, sizeof( storage ) );
+
+    deserializerContext.pStart = timeBuffer;
+    deserializerContext.totalLength = strlen( timeBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    deserializerContext.pStart = connectionBuffer;
+    deserializerContext.totalLength = strlen( connectionBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    deserializerContext.pStart = bandwidthBuffer;
+    deserializerContext.totalLength = strlen( bandwidthBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    deserializerContext.pStart = attributeBuffer;
+    deserializerContext.totalLength = strlen( attributeBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    deserializerContext.pStart = mediaBuffer;
+    deserializerContext.totalLength = strlen( mediaBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Malformed session descriptions are reported.
+ */
+void test_SdpDeserializer_ParseSession_Malformed( void )
+{
+    SdpResult_t result;
+    char versionBuffer[] = "v=x\r\n";
+    char originatorBuffer[] = "v=0\r\no=-\r\n";
+    char sessionLineInMediaBuffer[] = "v=0\r\nm=audio 9 RTP/AVP 0\r\ns=-\r\n";
+    char lineBuffer[] = "v=0\r\ns=-";
+    SdpSessionStorage_t storage;
+    SdpSessionDescription_t session;
+    SdpMediaDescription_t mediaDescriptions[ 1 ];
+
+    memset( &( storage ), 0, sizeof( storage ) );
+    storage.pMediaDescriptions = mediaDescriptions;
+    storage.mediaDescriptionsLength = 1;
+
+    deserializerContext.pStart = versionBuffer;
+    deserializerContext.totalLength = strlen( versionBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED, result );
+
+    deserializerContext.pStart = originatorBuffer;
+    deserializerContext.totalLength = strlen( originatorBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+
+    deserializerContext.pStart = sessionLineInMediaBuffer;
+    deserializerContext.totalLength = strlen( sessionLineInMediaBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED, result );
+
+    deserializerContext.pStart = lineBuffer;
+    deserializerContext.totalLength = strlen( lineBuffer );
+    deserializerContext.currentIndex = 0;
+    result = SdpDeserializer_ParseSession( &( deserializerContext ), &( storage ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Context, arena or session is NULL.
+ */
+void test_SdpDeserializer_ParseSessionWithArena_BadParams( void )
+{
+    SdpResult_t result;
+    SdpArena_t arena;
+    SdpSessionDescription_t session;
+
+    result = SdpDeserializer_ParseSessionWithArena( NULL, &( arena ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), NULL, &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Arrays are carved from the arena with the exact number of entries.
+ */
+void test_SdpDeserializer_ParseSessionWithArena_Pass( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "c=IN IP4 224.2.17.12\r\n"
+                    "t=0 0\r\n"
+                    "a=group:BUNDLE 0 1\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "a=mid:0\r\n"
+                    "m=video 9 UDP/TLS/RTP/SAVPF 96\r\n"
+                    "b=AS:2000\r\n"
+                    "a=mid:1\r\n";
+    uint64_t arenaBuffer[ 128 ];
+    SdpArena_t arena;
+    SdpSessionDescription_t session;
+
+    result = SdpArena_Init( &( arena ), arenaBuffer, sizeof( arenaBuffer ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), &( session ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( buffer ), deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 2 * sizeof( SdpMediaDescription_t ) +
+                       3 * sizeof( SdpAttribute_t ) +
+                       sizeof( SdpConnectionInfo_t ) +
+                       sizeof( SdpBandwidthInfo_t ) +
+                       sizeof( SdpTimeDescription_t ),
+                       arena.used );
+
+    TEST_ASSERT_EQUAL( 2, session.originator.sessionVersion );
+    TEST_ASSERT_EQUAL( 1, session.connectionInfoCount );
+    TEST_ASSERT_EQUAL( 1, session.timeDescriptionCount );
+    TEST_ASSERT_EQUAL( 1, session.attributeCount );
+    TEST_ASSERT_EQUAL( 2, session.mediaDescriptionCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", session.pMediaDescriptions[ 0 ].pAttributes[ 0 ].pAttributeValue, 1 );
+    TEST_ASSERT_EQUAL( 1, session.pMediaDescriptions[ 1 ].bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 2000, session.pMediaDescriptions[ 1 ].pBandwidthInfos[ 0 ].sdpBandwidthValue );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1", session.pMediaDescriptions[ 1 ].pAttributes[ 0 ].pAttributeValue, 1 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Nothing is allocated for a message without arrays.
+ */
+void test_SdpDeserializer_ParseSessionWithArena_NoArrays( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "s=-\r\n";
+    SdpArena_t arena;
+    SdpSessionDescription_t session;
+
+    result = SdpArena_Init( &( arena ), NULL, 0, NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), &( session ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+    TEST_ASSERT_EQUAL( 0, session.mediaDescriptionCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "-", session.pSessionName, session.sessionNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every array allocation fails in turn when the arena is too small.
+ */
+void test_SdpDeserializer_ParseSessionWithArena_OutOfMemory( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "c=IN IP4 224.2.17.12\r\n"
+                    "b=AS:256\r\n"
+                    "t=0 0\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "a=mid:0\r\n";
+    uint64_t arenaBuffer[ 64 ];
+    size_t requiredLength = sizeof( SdpMediaDescription_t ) +
+                            sizeof( SdpAttribute_t ) +
+                            sizeof( SdpConnectionInfo_t ) +
+                            sizeof( SdpBandwidthInfo_t ) +
+                            sizeof( SdpTimeDescription_t );
+    size_t arenaLength;
+    SdpArena_t arena;
+    SdpSessionDescription_t session;
+
+    for( arenaLength = 0; arenaLength < requiredLength; arenaLength += sizeof( uint64_t ) )
+    {
+        result = SdpArena_Init( &( arena ), arenaBuffer, arenaLength, NULL, NULL );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), &( session ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+        TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+    }
+
+    result = SdpArena_Init( &( arena ), arenaBuffer, requiredLength, NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Malformed line is reported by the counting pass.
+ */
+void test_SdpDeserializer_ParseSessionWithArena_Malformed( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "sx-\r\n";
+    SdpArena_t arena;
+    SdpSessionDescription_t session;
+
+    result = SdpArena_Init( &( arena ), NULL, 0, NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSessionWithArena( &( deserializerContext ), &( arena ), &( session ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND, result );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every registered attribute name is classified to its own kind.
+ */
+void test_SdpDeserializer_GetAttributeKind_Pass( void )
+{
+    struct
+    {
+        const char * pName;
+        SdpAttributeKind_t kind;
+    } registry[] =
+    {
+        { "cat", SDP_ATTRIBUTE_KIND_CAT },
+        { "keywds", SDP_ATTRIBUTE_KIND_KEYWDS },
+        { "tool", SDP_ATTRIBUTE_KIND_TOOL },
+        { "ptime", SDP_ATTRIBUTE_KIND_PTIME },
+        { "maxptime", SDP_ATTRIBUTE_KIND_MAXPTIME },
+        { "rtpmap", SDP_ATTRIBUTE_KIND_RTPMAP },
+        { "recvonly", SDP_ATTRIBUTE_KIND_RECVONLY },
+        { "sendrecv", SDP_ATTRIBUTE_KIND_SENDRECV },
+        { "sendonly", SDP_ATTRIBUTE_KIND_SENDONLY },
+        { "inactive", SDP_ATTRIBUTE_KIND_INACTIVE },
+        { "orient", SDP_ATTRIBUTE_KIND_ORIENT },
+        { "type", SDP_ATTRIBUTE_KIND_TYPE },
+        { "charset", SDP_ATTRIBUTE_KIND_CHARSET },
+        { "sdplang", SDP_ATTRIBUTE_KIND_SDPLANG },
+        { "lang", SDP_ATTRIBUTE_KIND_LANG },
+        { "framerate", SDP_ATTRIBUTE_KIND_FRAMERATE },
+        { "quality", SDP_ATTRIBUTE_KIND_QUALITY },
+        { "fmtp", SDP_ATTRIBUTE_KIND_FMTP },
+        { "ice-ufrag", SDP_ATTRIBUTE_KIND_ICE_UFRAG },
+        { "ice-pwd", SDP_ATTRIBUTE_KIND_ICE_PWD },
+        { "ice-options", SDP_ATTRIBUTE_KIND_ICE_OPTIONS },
+        { "ice-lite", SDP_ATTRIBUTE_KIND_ICE_LITE },
+        { "ice-mismatch", SDP_ATTRIBUTE_KIND_ICE_MISMATCH },
+        { "ice-pacing", SDP_ATTRIBUTE_KIND_ICE_PACING },
+        { "candidate", SDP_ATTRIBUTE_KIND_CANDIDATE },
+        { "remote-candidates", SDP_ATTRIBUTE_KIND_REMOTE_CANDIDATES },
+        { "end-of-candidates", SDP_ATTRIBUTE_KIND_END_OF_CANDIDATES },
+        { "fingerprint", SDP_ATTRIBUTE_KIND_FINGERPRINT },
+        { "setup", SDP_ATTRIBUTE_KIND_SETUP },
+        { "connection", SDP_ATTRIBUTE_KIND_CONNECTION },
+        { "mid", SDP_ATTRIBUTE_KIND_MID },
+        { "group", SDP_ATTRIBUTE_KIND_GROUP },
+        { "msid", SDP_ATTRIBUTE_KIND_MSID },
+        { "msid-semantic", SDP_ATTRIBUTE_KIND_MSID_SEMANTIC },
+        { "ssrc", SDP_ATTRIBUTE_KIND_SSRC },
+        { "ssrc-group", SDP_ATTRIBUTE_KIND_SSRC_GROUP },
+        { "rtcp", SDP_ATTRIBUTE_KIND_RTCP },
+        { "rtcp-mux", SDP_ATTRIBUTE_KIND_RTCP_MUX },
+        { "rtcp-mux-only", SDP_ATTRIBUTE_KIND_RTCP_MUX_ONLY },
+        { "rtcp-rsize", SDP_ATTRIBUTE_KIND_RTCP_RSIZE },
+        { "rtcp-fb", SDP_ATTRIBUTE_KIND_RTCP_FB },
+        { "extmap", SDP_ATTRIBUTE_KIND_EXTMAP },
+        { "extmap-allow-mixed", SDP_ATTRIBUTE_KIND_EXTMAP_ALLOW_MIXED },
+        { "rid", SDP_ATTRIBUTE_KIND_RID },
+        { "simulcast", SDP_ATTRIBUTE_KIND_SIMULCAST },
+        { "sctp-port", SDP_ATTRIBUTE_KIND_SCTP_PORT },
+        { "max-message-size", SDP_ATTRIBUTE_KIND_MAX_MESSAGE_SIZE },
+        { "sctpmap", SDP_ATTRIBUTE_KIND_SCTPMAP },
+        { "crypto", SDP_ATTRIBUTE_KIND_CRYPTO },
+        { "identity", SDP_ATTRIBUTE_KIND_IDENTITY },
+        { "bundle-only", SDP_ATTRIBUTE_KIND_BUNDLE_ONLY },
+        { "label", SDP_ATTRIBUTE_KIND_LABEL },
+        { "content", SDP_ATTRIBUTE_KIND_CONTENT },
+        { "tls-id", SDP_ATTRIBUTE_KIND_TLS_ID }
+    };
+    size_t i;
+
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_COUNT - 1, sizeof( registry ) / sizeof( registry[ 0 ] ) );
+
+    for( i = 0; i < sizeof( registry ) / sizeof( registry[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL( registry[ i ].kind, SdpDeserializer_GetAttributeKind( registry[ i ].pName, strlen( registry[ i ].pName ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Names outside the registry are unknown.
+ */
+void test_SdpDeserializer_GetAttributeKind_Unknown( void )
+{
+    /* NULL, too short and too long. */
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( NULL, 3 ) );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "mid", 2 ) );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "extmap-allow-mixed1", 19 ) );
+
+    /* Same slot as "mid" and "rtpmap" but a different name. */
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "aae", 3 ) );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "rtpmbp", 6 ) );
+
+    /* Names are case sensitive. */
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "RTPMAP", 6 ) );
+
+    /* Prefix of a registered name. */
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "candidate", 8 ) );
+
+    /* Non-ASCII bytes. */
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_UNKNOWN, SdpDeserializer_GetAttributeKind( "\xff\xfe\xfd\xfc", 4 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attribute is parsed and classified.
+ */
+void test_SdpDeserializer_ParseAttributeWithKind_Pass( void )
+{
+    SdpResult_t result;
+    char buffer[] = "rtpmap:111 opus/48000/2";
+    SdpAttribute_t attribute;
+    SdpAttributeKind_t kind;
+
+    result = SdpDeserializer_ParseAttributeWithKind( buffer, strlen( buffer ), &( attribute ), &( kind ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_RTPMAP, kind );
+    TEST_ASSERT_EQUAL_STRING_LEN( "rtpmap", attribute.pAttributeName, attribute.attributeNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "111 opus/48000/2", attribute.pAttributeValue, attribute.attributeValueLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Value, attribute or kind is NULL.
+ */
+void test_SdpDeserializer_ParseAttributeWithKind_BadParams( void )
+{
+    SdpResult_t result;
+    char buffer[] = "sendrecv";
+    SdpAttribute_t attribute;
+    SdpAttributeKind_t kind = SDP_ATTRIBUTE_KIND_COUNT;
+
+    result = SdpDeserializer_ParseAttributeWithKind( NULL, strlen( buffer ), &( attribute ), &( kind ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseAttributeWithKind( buffer, strlen( buffer ), NULL, &( kind ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseAttributeWithKind( buffer, strlen( buffer ), &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_COUNT, kind );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Host candidate with extensions, as sent by browsers.
+ */
+void test_SdpDeserializer_ParseIceCandidate_Host( void )
+{
+    SdpResult_t result;
+    char buffer[] = "candidate:1467250027 1 udp 2122260223 192.168.0.196 46243 typ host generation 0 ufrag EsAw network-id 1";
+    SdpIceCandidate_t candidate;
+
+    result = SdpDeserializer_ParseIceCandidate( buffer, strlen( buffer ), &( candidate ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1467250027", candidate.pFoundation, candidate.foundationLength );
+    TEST_ASSERT_EQUAL( 10, candidate.foundationLength );
+    TEST_ASSERT_EQUAL( 1, candidate.componentId );
+    TEST_ASSERT_EQUAL_STRING_LEN( "udp", candidate.pTransport, candidate.transportLength );
+    TEST_ASSERT_EQUAL( 3, candidate.transportLength );
+    TEST_ASSERT_EQUAL( 2122260223U, candidate.priority );
+    TEST_ASSERT_EQUAL_STRING_LEN( "192.168.0.196", candidate.pAddress, candidate.addressLength );
+    TEST_ASSERT_EQUAL( 13, candidate.addressLength );
+    TEST_ASSERT_EQUAL( 46243, candidate.port );
+    TEST_ASSERT_EQUAL( SDP_ICE_CANDIDATE_TYPE_HOST, candidate.candidateType );
+    TEST_ASSERT_EQUAL( NULL, candidate.pRelatedAddress );
+    TEST_ASSERT_EQUAL( 0, candidate.relatedPort );
+    TEST_ASSERT_EQUAL( NULL, candidate.pTcpType );
+    TEST_ASSERT_EQUAL( 3, candidate.extensionCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "generation", candidate.extensions[ 0 ].pName, candidate.extensions[ 0 ].nameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", candidate.extensions[ 0 ].pValue, candidate.extensions[ 0 ].valueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "ufrag", candidate.extensions[ 1 ].pName, candidate.extensions[ 1 ].nameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "EsAw", candidate.extensions[ 1 ].pValue, candidate.extensions[ 1 ].valueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "network-id", candidate.extensions[ 2 ].pName, candidate.extensions[ 2 ].nameLength );
+    TEST_ASSERT_EQUAL( 1, candidate.extensions[ 2 ].valueLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Candidates with related address, related port and tcptype. The
+ * value is not NULL terminated.
+ */
+void test_SdpDeserializer_ParseIceCandidate_RelatedAddress( void )
+{
+    SdpResult_t result;
+    char buffer[] = "842163049 1 UDP 1677729535 203.0.113.7 61665 typ srflx raddr 10.0.1.1 rport 8998XX";
+    char tcpBuffer[] = "2 1 TCP 1518280447 10.0.1.1 9 typ host tcptype active";
+    SdpIceCandidate_t candidate;
+
+    result = SdpDeserializer_ParseIceCandidate( buffer, strlen( buffer ) - 2, &( candidate ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "842163049", candidate.pFoundation, candidate.foundationLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "UDP", candidate.pTransport, candidate.transportLength );
+    TEST_ASSERT_EQUAL( 1677729535U, candidate.priority );
+    TEST_ASSERT_EQUAL( 61665, candidate.port );
+    TEST_ASSERT_EQUAL( SDP_ICE_CANDIDATE_TYPE_SRFLX, candidate.candidateType );
+    TEST_ASSERT_EQUAL_STRING_LEN( "10.0.1.1", candidate.pRelatedAddress, candidate.relatedAddressLength );
+    TEST_ASSERT_EQUAL( 8, candidate.relatedAddressLength );
+    TEST_ASSERT_EQUAL( 8998, candidate.relatedPort );
+    TEST_ASSERT_EQUAL( 0, candidate.extensionCount );
+
+    result = SdpDeserializer_ParseIceCandidate( tcpBuffer, strlen( tcpBuffer ), &( candidate ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 9, candidate.port );
+    TEST_ASSERT_EQUAL_STRING_LEN( "active", candidate.pTcpType, candidate.tcpTypeLength );
+    TEST_ASSERT_EQUAL( 6, candidate.tcpTypeLength );
+    TEST_ASSERT_EQUAL( 0, candidate.extensionCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every candidate type is recognized.
+ */
+void test_SdpDeserializer_ParseIceCandidate_Types( void )
+{
+    SdpResult_t result;
+    struct
+    {
+        const char * pValue;
+        SdpIceCandidateType_t candidateType;
+    } testCases[] =
+    {
+        { "1 1 udp 1 ::1 1 typ host", SDP_ICE_CANDIDATE_TYPE_HOST },
+        { "1 1 udp 1 ::1 1 typ srflx", SDP_ICE_CANDIDATE_TYPE_SRFLX },
+        { "1 1 udp 1 ::1 1 typ prflx", SDP_ICE_CANDIDATE_TYPE_PRFLX },
+        { "1 1 udp 1 ::1 1 typ relay", SDP_ICE_CANDIDATE_TYPE_RELAY },
+        { "1 1 udp 1 ::1 1 typ other  ", SDP_ICE_CANDIDATE_TYPE_UNKNOWN }
+    };
+    SdpIceCandidate_t candidate;
+    size_t i;
+
+    for( i = 0; i < sizeof( testCases ) / sizeof( testCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseIceCandidate( testCases[ i ].pValue, strlen( testCases[ i ].pValue ), &( candidate ) );
+
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( testCases[ i ].candidateType, candidate.candidateType );
+        TEST_ASSERT_EQUAL_STRING_LEN( "::1", candidate.pAddress, candidate.addressLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Value or candidate is NULL.
+ */
+void test_SdpDeserializer_ParseIceCandidate_BadParams( void )
+{
+    SdpResult_t result;
+    char buffer[] = "1 1 udp 1 ::1 1 typ host";
+    SdpIceCandidate_t candidate;
+
+    result = SdpDeserializer_ParseIceCandidate( NULL, strlen( buffer ), &( candidate ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseIceCandidate( buffer, strlen( buffer ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A field is missing or invalid.
+ */
+void test_SdpDeserializer_ParseIceCandidate_Malformed( void )
+{
+    SdpResult_t result;
+    const char * pTestCases[] =
+    {
+        "",
+        "candidate:",
+        "1",
+        "1 x",
+        "1 65536",
+        "1 1",
+        "1 1 udp",
+        "1 1 udp 4294967296",
+        "1 1 udp 1",
+        "1 1 udp 1 ::1",
+        "1 1 udp 1 ::1 -1",
+        "1 1 udp 1 ::1 1",
+        "1 1 udp 1 ::1 1 type host",
+        "1 1 udp 1 ::1 1 typ",
+        "1 1 udp 1 ::1 1 typ host generation",
+        "1 1 udp 1 ::1 1 typ srflx raddr ::2 rport 65536"
+    };
+    SdpIceCandidate_t candidate;
+    size_t i;
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseIceCandidate( pTestCases[ i ], strlen( pTestCases[ i ] ), &( candidate ) );
+
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_CANDIDATE, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief More extensions than SDP_ICE_CANDIDATE_MAX_EXTENSIONS.
+ */
+void test_SdpDeserializer_ParseIceCandidate_TooManyExtensions( void )
+{
+    SdpResult_t result;
+    char buffer[ 512 ];
+    size_t i, length;
+    SdpIceCandidate_t candidate;
+
+    length = ( size_t ) snprintf( buffer, sizeof( buffer ), "1 1 udp 1 ::1 1 typ host" );
+
+    for( i = 0; i < SDP_ICE_CANDIDATE_MAX_EXTENSIONS; i++ )
+    {
+        length += ( size_t ) snprintf( &( buffer[ length ] ), sizeof( buffer ) - length, " k%u v", ( unsigned int ) i );
+    }
+
+    result = SdpDeserializer_ParseIceCandidate( buffer, length, &( candidate ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_ICE_CANDIDATE_MAX_EXTENSIONS, candidate.extensionCount );
+
+    length += ( size_t ) snprintf( &( buffer[ length ] ), sizeof( buffer ) - length, " one more" );
+
+    result = SdpDeserializer_ParseIceCandidate( buffer, length, &( candidate ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Audio and video rtpmap attributes, with and without channels.
+ */
+void test_SdpDeserializer_ParseRtpMap_Pass( void )
+{
+    SdpResult_t result;
+    char opusBuffer[] = "rtpmap:111 opus/48000/2";
+    char h264Buffer[] = "rtpmap:96 H264/90000XX";
+    SdpAttribute_t attribute;
+    SdpRtpMap_t rtpMap;
+
+    result = SdpDeserializer_ParseAttribute( opusBuffer, strlen( opusBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtpMap( &( attribute ), &( rtpMap ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 111, rtpMap.payloadType );
+    TEST_ASSERT_EQUAL_STRING_LEN( "opus", rtpMap.pEncodingName, rtpMap.encodingNameLength );
+    TEST_ASSERT_EQUAL( 4, rtpMap.encodingNameLength );
+    TEST_ASSERT_EQUAL( 48000, rtpMap.clockRate );
+    TEST_ASSERT_EQUAL( 2, rtpMap.channels );
+
+    /* The value is not NULL terminated. */
+    result = SdpDeserializer_ParseAttribute( h264Buffer, strlen( h264Buffer ) - 2, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtpMap( &( attribute ), &( rtpMap ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 96, rtpMap.payloadType );
+    TEST_ASSERT_EQUAL_STRING_LEN( "H264", rtpMap.pEncodingName, rtpMap.encodingNameLength );
+    TEST_ASSERT_EQUAL( 4, rtpMap.encodingNameLength );
+    TEST_ASSERT_EQUAL( 90000, rtpMap.clockRate );
+    TEST_ASSERT_EQUAL( 0, rtpMap.channels );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attribute or output is NULL, or the attribute is not rtpmap.
+ */
+void test_SdpDeserializer_ParseRtpMap_BadParams( void )
+{
+    SdpResult_t result;
+    char buffer[] = "fmtp:111 opus/48000/2";
+    SdpAttribute_t attribute;
+    SdpRtpMap_t rtpMap;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtpMap( NULL, &( rtpMap ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseRtpMap( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseRtpMap( &( attribute ), &( rtpMap ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A field is missing or invalid.
+ */
+void test_SdpDeserializer_ParseRtpMap_Malformed( void )
+{
+    SdpResult_t result;
+    const char * pTestCases[] =
+    {
+        "rtpmap",
+        "rtpmap:",
+        "rtpmap:96",
+        "rtpmap:128 opus/48000",
+        "rtpmap:x opus/48000",
+        "rtpmap:96 opus",
+        "rtpmap:96 /48000",
+        "rtpmap:96 opus/",
+        "rtpmap:96 opus/x",
+        "rtpmap:96 opus/4294967296",
+        "rtpmap:96 opus/48000/",
+        "rtpmap:96 opus/48000/65536",
+        "rtpmap:96 opus/48000/2/1",
+        "rtpmap:96 opus/48000 extra"
+    };
+    SdpAttribute_t attribute;
+    SdpRtpMap_t rtpMap;
+    size_t i;
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseRtpMap( &( attribute ), &( rtpMap ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Iterate over the parameters of an H.264 fmtp attribute.
+ */
+void test_SdpDeserializer_ParseFmtp_Pass( void )
+{
+    SdpResult_t result;
+    char buffer[] = "fmtp:102 level-asymmetry-allowed=1; packetization-mode = 1 ;;profile-level-id=42001f;0-15 ";
+    SdpAttribute_t attribute;
+    SdpFmtp_t fmtp;
+    SdpFmtpParameter_t parameter;
+    size_t offset = 0;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFmtp( &( attribute ), &( fmtp ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 102, fmtp.payloadType );
+    TEST_ASSERT_EQUAL_PTR( &( buffer[ 9 ] ), fmtp.pParameters );
+    TEST_ASSERT_EQUAL( strlen( buffer ) - 10, fmtp.parametersLength );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "level-asymmetry-allowed", parameter.pKey, parameter.keyLength );
+    TEST_ASSERT_EQUAL( 23, parameter.keyLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1", parameter.pValue, parameter.valueLength );
+    TEST_ASSERT_EQUAL( 1, parameter.valueLength );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "packetization-mode", parameter.pKey, parameter.keyLength );
+    TEST_ASSERT_EQUAL( 18, parameter.keyLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1", parameter.pValue, parameter.valueLength );
+    TEST_ASSERT_EQUAL( 1, parameter.valueLength );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "profile-level-id", parameter.pKey, parameter.keyLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "42001f", parameter.pValue, parameter.valueLength );
+    TEST_ASSERT_EQUAL( 6, parameter.valueLength );
+
+    /* A parameter without a value. */
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0-15", parameter.pKey, parameter.keyLength );
+    TEST_ASSERT_EQUAL( 4, parameter.keyLength );
+    TEST_ASSERT_EQUAL( NULL, parameter.pValue );
+    TEST_ASSERT_EQUAL( 0, parameter.valueLength );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief NULL inputs, an attribute that is not fmtp, or no parameters.
+ */
+void test_SdpDeserializer_ParseFmtp_BadParams( void )
+{
+    SdpResult_t result;
+    char buffer[] = "rtpmap:111 opus/48000/2";
+    SdpAttribute_t attribute;
+    SdpFmtp_t fmtp;
+    SdpFmtpParameter_t parameter;
+    size_t offset = 0;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFmtp( NULL, &( fmtp ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseFmtp( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseFmtp( &( attribute ), &( fmtp ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_GetNextFmtpParameter( NULL, &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    fmtp.pParameters = buffer;
+    fmtp.parametersLength = strlen( buffer );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), NULL, &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Payload type or parameters are missing or invalid.
+ */
+void test_SdpDeserializer_ParseFmtp_Malformed( void )
+{
+    SdpResult_t result;
+    const char * pTestCases[] =
+    {
+        "fmtp",
+        "fmtp:",
+        "fmtp:111",
+        "fmtp:111   ",
+        "fmtp:200 apt=96",
+        "fmtp:x apt=96"
+    };
+    char emptyKeyBuffer[] = "fmtp:97 apt=96; =1";
+    SdpAttribute_t attribute;
+    SdpFmtp_t fmtp;
+    SdpFmtpParameter_t parameter;
+    size_t i, offset = 0;
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseFmtp( &( attribute ), &( fmtp ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP, result );
+    }
+
+    result = SdpDeserializer_ParseAttribute( emptyKeyBuffer, strlen( emptyKeyBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFmtp( &( attribute ), &( fmtp ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "apt", parameter.pKey, parameter.keyLength );
+
+    result = SdpDeserializer_GetNextFmtpParameter( &( fmtp ), &( offset ), &( parameter ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_FMTP, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief SHA-256, SHA-1 and SHA-512 fingerprints in upper and lower case.
+ */
+void test_SdpDeserializer_ParseFingerprint_Pass( void )
+{
+    SdpResult_t result;
+    char sha256Buffer[] = "fingerprint:SHA-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2";
+    char sha1Buffer[] = "fingerprint:sha-1 4a:ad:b9:b1:3f:82:18:3b:54:02:12:df:3e:5d:49:6b:19:e5:7c:abXX";
+    char sha512Buffer[ 256 ];
+    const uint8_t sha256Digest[] =
+    {
+        0x19, 0xE2, 0x1C, 0x3B, 0x4B, 0x9F, 0x81, 0xE6, 0xB8, 0x5C, 0xF4, 0xA5, 0xA8, 0xD8, 0x73, 0x04,
+        0xBB, 0x05, 0x2F, 0x70, 0x9F, 0x04, 0xA9, 0x0E, 0x05, 0xE9, 0x26, 0x33, 0xE8, 0x70, 0x88, 0xA2
+    };
+    const uint8_t sha1Digest[] =
+    {
+        0x4A, 0xAD, 0xB9, 0xB1, 0x3F, 0x82, 0x18, 0x3B, 0x54, 0x02,
+        0x12, 0xDF, 0x3E, 0x5D, 0x49, 0x6B, 0x19, 0xE5, 0x7C, 0xAB
+    };
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+    size_t i, length;
+
+    result = SdpDeserializer_ParseAttribute( sha256Buffer, strlen( sha256Buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_FINGERPRINT_HASH_SHA_256, fingerprint.hashFunction );
+    TEST_ASSERT_EQUAL_STRING_LEN( "SHA-256", fingerprint.pHashName, fingerprint.hashNameLength );
+    TEST_ASSERT_EQUAL( 7, fingerprint.hashNameLength );
+    TEST_ASSERT_EQUAL( sizeof( sha256Digest ), fingerprint.digestLength );
+    TEST_ASSERT_EQUAL_MEMORY( sha256Digest, fingerprint.digest, sizeof( sha256Digest ) );
+
+    /* The value is not NULL terminated. */
+    result = SdpDeserializer_ParseAttribute( sha1Buffer, strlen( sha1Buffer ) - 2, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_FINGERPRINT_HASH_SHA_1, fingerprint.hashFunction );
+    TEST_ASSERT_EQUAL( sizeof( sha1Digest ), fingerprint.digestLength );
+    TEST_ASSERT_EQUAL_MEMORY( sha1Digest, fingerprint.digest, sizeof( sha1Digest ) );
+
+    length = ( size_t ) snprintf( sha512Buffer, sizeof( sha512Buffer ), "fingerprint:sha-512 00" );
+
+    for( i = 1; i < 64U; i++ )
+    {
+        length += ( size_t ) snprintf( &( sha512Buffer[ length ] ), sizeof( sha512Buffer ) - length, ":%02X", ( unsigned int ) ( i * 3U ) );
+    }
+
+    result = SdpDeserializer_ParseAttribute( sha512Buffer, length, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_FINGERPRINT_HASH_SHA_512, fingerprint.hashFunction );
+    TEST_ASSERT_EQUAL( 64, fingerprint.digestLength );
+
+    for( i = 0; i < 64U; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( uint8_t ) ( i * 3U ), fingerprint.digest[ i ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A hash function outside the registry is decoded as is.
+ */
+void test_SdpDeserializer_ParseFingerprint_UnknownHash( void )
+{
+    SdpResult_t result;
+    char buffer[] = "fingerprint:sha3-256 01:02:03";
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_FINGERPRINT_HASH_UNKNOWN, fingerprint.hashFunction );
+    TEST_ASSERT_EQUAL_STRING_LEN( "sha3-256", fingerprint.pHashName, fingerprint.hashNameLength );
+    TEST_ASSERT_EQUAL( 3, fingerprint.digestLength );
+    TEST_ASSERT_EQUAL( 0x01, fingerprint.digest[ 0 ] );
+    TEST_ASSERT_EQUAL( 0x02, fingerprint.digest[ 1 ] );
+    TEST_ASSERT_EQUAL( 0x03, fingerprint.digest[ 2 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attribute or output is NULL, or the attribute is not fingerprint.
+ */
+void test_SdpDeserializer_ParseFingerprint_BadParams( void )
+{
+    SdpResult_t result;
+    char buffer[] = "setup:sha-1 00";
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( NULL, &( fingerprint ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Invalid characters, separators or lengths, in the vectorized blocks
+ * and in the tail.
+ */
+void test_SdpDeserializer_ParseFingerprint_Malformed( void )
+{
+    SdpResult_t result;
+    const char * pTestCases[] =
+    {
+        "fingerprint",
+        "fingerprint:",
+        "fingerprint:sha-256",
+        "fingerprint:sha-256 19:E2 extra",
+        "fingerprint:x 1",
+        "fingerprint:x 123",
+        "fingerprint:x 12:",
+        "fingerprint:x 12-34",
+        "fingerprint:x 1G",
+        "fingerprint:x \x80\x80",
+        "fingerprint:sha-1 19:E2",
+        /* Invalid digit, separator and high byte in the first block. */
+        "fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:0G:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2",
+        "fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04-BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2",
+        "fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:\xC1\xA2",
+        "fingerprint:sha-256 19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:/2",
+        /* Invalid tail. */
+        "fingerprint:sha-1 4a:ad:b9:b1:3f:82:18:3b:54:02:12:df:3e:5d:49:6b:19:e5:7c:ag",
+        "fingerprint:sha-1 4a:ad:b9:b1:3f:82:18:3b:54:02:12:df:3e:5d:49:6b:19:e5:7c;ab"
+    };
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+    size_t i;
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_FINGERPRINT, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A digest longer than SDP_FINGERPRINT_MAX_DIGEST_LENGTH.
+ */
+void test_SdpDeserializer_ParseFingerprint_OutOfMemory( void )
+{
+    SdpResult_t result;
+    char buffer[ 256 ];
+    size_t i, length;
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+
+    length = ( size_t ) snprintf( buffer, sizeof( buffer ), "fingerprint:x 00" );
+
+    for( i = 1; i <= SDP_FINGERPRINT_MAX_DIGEST_LENGTH; i++ )
+    {
+        length += ( size_t ) snprintf( &( buffer[ length ] ), sizeof( buffer ) - length, ":00" );
+    }
+
+    result = SdpDeserializer_ParseAttribute( buffer, length, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Compare a fingerprint with matching and different digests.
+ */
+void test_SdpDeserializer_CompareFingerprint( void )
+{
+    SdpResult_t result;
+    char buffer[] = "fingerprint:sha-1 4A:AD:B9:B1:3F:82:18:3B:54:02:12:DF:3E:5D:49:6B:19:E5:7C:AB";
+    uint8_t digest[] =
+    {
+        0x4A, 0xAD, 0xB9, 0xB1, 0x3F, 0x82, 0x18, 0x3B, 0x54, 0x02,
+        0x12, 0xDF, 0x3E, 0x5D, 0x49, 0x6B, 0x19, 0xE5, 0x7C, 0xAB
+    };
+    SdpAttribute_t attribute;
+    SdpFingerprint_t fingerprint;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseFingerprint( &( attribute ), &( fingerprint ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_CompareFingerprint( NULL, digest, sizeof( digest ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_CompareFingerprint( &( fingerprint ), NULL, sizeof( digest ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_CompareFingerprint( &( fingerprint ), digest, sizeof( digest ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_CompareFingerprint( &( fingerprint ), digest, sizeof( digest ) - 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_FINGERPRINT_MISMATCH, result );
+
+    digest[ sizeof( digest ) - 1 ] ^= 0x01;
+
+    result = SdpDeserializer_CompareFingerprint( &( fingerprint ), digest, sizeof( digest ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_FINGERPRINT_MISMATCH, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief rtcp-fb with a payload type, a wildcard and a parameter.
+ */
+void test_SdpDeserializer_ParseRtcpFeedback_Pass( void )
+{
+    SdpResult_t result;
+    char nackBuffer[] = "rtcp-fb:96 nack pli";
+    char rembBuffer[] = "rtcp-fb:* goog-remb";
+    SdpAttribute_t attribute;
+    SdpRtcpFeedback_t rtcpFeedback;
+
+    result = SdpDeserializer_ParseAttribute( nackBuffer, strlen( nackBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtcpFeedback( &( attribute ), &( rtcpFeedback ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 96, rtcpFeedback.payloadType );
+    TEST_ASSERT_EQUAL( 0, rtcpFeedback.allPayloadTypes );
+    TEST_ASSERT_EQUAL_STRING_LEN( "nack", rtcpFeedback.pType, rtcpFeedback.typeLength );
+    TEST_ASSERT_EQUAL( 4, rtcpFeedback.typeLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "pli", rtcpFeedback.pParameter, rtcpFeedback.parameterLength );
+    TEST_ASSERT_EQUAL( 3, rtcpFeedback.parameterLength );
+
+    result = SdpDeserializer_ParseAttribute( rembBuffer, strlen( rembBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtcpFeedback( &( attribute ), &( rtcpFeedback ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, rtcpFeedback.payloadType );
+    TEST_ASSERT_EQUAL( 1, rtcpFeedback.allPayloadTypes );
+    TEST_ASSERT_EQUAL_STRING_LEN( "goog-remb", rtcpFeedback.pType, rtcpFeedback.typeLength );
+    TEST_ASSERT_EQUAL( 9, rtcpFeedback.typeLength );
+    TEST_ASSERT_EQUAL( NULL, rtcpFeedback.pParameter );
+    TEST_ASSERT_EQUAL( 0, rtcpFeedback.parameterLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief rtcp-fb with bad parameters or a missing or invalid field.
+ */
+void test_SdpDeserializer_ParseRtcpFeedback_Invalid( void )
+{
+    SdpResult_t result;
+    char otherBuffer[] = "rtcp:9 IN IP4 0.0.0.0";
+    const char * pTestCases[] =
+    {
+        "rtcp-fb",
+        "rtcp-fb:",
+        "rtcp-fb:96",
+        "rtcp-fb:96   ",
+        "rtcp-fb:128 nack",
+        "rtcp-fb:** nack"
+    };
+    SdpAttribute_t attribute;
+    SdpRtcpFeedback_t rtcpFeedback;
+    size_t i;
+
+    result = SdpDeserializer_ParseAttribute( otherBuffer, strlen( otherBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseRtcpFeedback( NULL, &( rtcpFeedback ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseRtcpFeedback( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseRtcpFeedback( &( attribute ), &( rtcpFeedback ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseRtcpFeedback( &( attribute ), &( rtcpFeedback ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTCP_FB, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief extmap with and without a direction and extension attributes.
+ */
+void test_SdpDeserializer_ParseExtMap_Pass( void )
+{
+    SdpResult_t result;
+    const char * pUri = "urn:ietf:params:rtp-hdrext:sdes:mid";
+    char buffer[] = "extmap:4 urn:ietf:params:rtp-hdrext:sdes:mid";
+    char directionBuffer[] = "extmap:12/recvonly urn:ietf:params:rtp-hdrext:sdes:mid  attr1 attr2 ";
+    struct
+    {
+        const char * pValue;
+        SdpExtMapDirection_t direction;
+    } testCases[] =
+    {
+        { "extmap:1/sendrecv x", SDP_EXTMAP_DIRECTION_SENDRECV },
+        { "extmap:1/sendonly x", SDP_EXTMAP_DIRECTION_SENDONLY },
+        { "extmap:1/recvonly x", SDP_EXTMAP_DIRECTION_RECVONLY },
+        { "extmap:1/inactive x", SDP_EXTMAP_DIRECTION_INACTIVE }
+    };
+    SdpAttribute_t attribute;
+    SdpExtMap_t extMap;
+    size_t i;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseExtMap( &( attribute ), &( extMap ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, extMap.id );
+    TEST_ASSERT_EQUAL( SDP_EXTMAP_DIRECTION_NONE, extMap.direction );
+    TEST_ASSERT_EQUAL_STRING_LEN( pUri, extMap.pUri, extMap.uriLength );
+    TEST_ASSERT_EQUAL( strlen( pUri ), extMap.uriLength );
+    TEST_ASSERT_EQUAL( NULL, extMap.pExtensionAttributes );
+    TEST_ASSERT_EQUAL( 0, extMap.extensionAttributesLength );
+
+    result = SdpDeserializer_ParseAttribute( directionBuffer, strlen( directionBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseExtMap( &( attribute ), &( extMap ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 12, extMap.id );
+    TEST_ASSERT_EQUAL( SDP_EXTMAP_DIRECTION_RECVONLY, extMap.direction );
+    TEST_ASSERT_EQUAL_STRING_LEN( pUri, extMap.pUri, extMap.uriLength );
+    TEST_ASSERT_EQUAL( strlen( pUri ), extMap.uriLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "attr1 attr2", extMap.pExtensionAttributes, extMap.extensionAttributesLength );
+    TEST_ASSERT_EQUAL( 11, extMap.extensionAttributesLength );
+
+    for( i = 0; i < sizeof( testCases ) / sizeof( testCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( testCases[ i ].pValue, strlen( testCases[ i ].pValue ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseExtMap( &( attribute ), &( extMap ) );
+
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( 1, extMap.id );
+        TEST_ASSERT_EQUAL( testCases[ i ].direction, extMap.direction );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief extmap with bad parameters or a missing or invalid field.
+ */
+void test_SdpDeserializer_ParseExtMap_Invalid( void )
+{
+    SdpResult_t result;
+    char otherBuffer[] = "extmap-allow-mixed";
+    const char * pTestCases[] =
+    {
+        "extmap",
+        "extmap:",
+        "extmap:1",
+        "extmap:0 x",
+        "extmap:65536 x",
+        "extmap:x x",
+        "extmap:/sendrecv x",
+        "extmap:1/ x",
+        "extmap:1/both x",
+        "extmap:1/sendrecv"
+    };
+    SdpAttribute_t attribute;
+    SdpExtMap_t extMap;
+    size_t i;
+
+    result = SdpDeserializer_ParseAttribute( otherBuffer, strlen( otherBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseExtMap( NULL, &( extMap ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseExtMap( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseExtMap( &( attribute ), &( extMap ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseExtMap( &( attribute ), &( extMap ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_EXTMAP, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief ssrc attributes with a value, a value with spaces and no value.
+ */
+void test_SdpDeserializer_ParseSsrc_Pass( void )
+{
+    SdpResult_t result;
+    char cnameBuffer[] = "ssrc:4294967295 cname:4TOk42mSjXCkVIa6";
+    char msidBuffer[] = "ssrc:3735928559 msid:stream0 track0XX";
+    char flagBuffer[] = "ssrc:1 flag ";
+    SdpAttribute_t attribute;
+    SdpSsrc_t ssrc;
+
+    result = SdpDeserializer_ParseAttribute( cnameBuffer, strlen( cnameBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrc( &( attribute ), &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4294967295U, ssrc.ssrc );
+    TEST_ASSERT_EQUAL_STRING_LEN( "cname", ssrc.pAttributeName, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL( 5, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "4TOk42mSjXCkVIa6", ssrc.pAttributeValue, ssrc.attributeValueLength );
+    TEST_ASSERT_EQUAL( 16, ssrc.attributeValueLength );
+
+    /* The value is not NULL terminated. */
+    result = SdpDeserializer_ParseAttribute( msidBuffer, strlen( msidBuffer ) - 2, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrc( &( attribute ), &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3735928559U, ssrc.ssrc );
+    TEST_ASSERT_EQUAL_STRING_LEN( "msid", ssrc.pAttributeName, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL( 4, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "stream0 track0", ssrc.pAttributeValue, ssrc.attributeValueLength );
+    TEST_ASSERT_EQUAL( 14, ssrc.attributeValueLength );
+
+    result = SdpDeserializer_ParseAttribute( flagBuffer, strlen( flagBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrc( &( attribute ), &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, ssrc.ssrc );
+    TEST_ASSERT_EQUAL_STRING_LEN( "flag", ssrc.pAttributeName, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL( 4, ssrc.attributeNameLength );
+    TEST_ASSERT_EQUAL( NULL, ssrc.pAttributeValue );
+    TEST_ASSERT_EQUAL( 0, ssrc.attributeValueLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief ssrc with bad parameters or a missing or invalid field.
+ */
+void test_SdpDeserializer_ParseSsrc_Invalid( void )
+{
+    SdpResult_t result;
+    char otherBuffer[] = "ssrc-group:FID 1 2";
+    const char * pTestCases[] =
+    {
+        "ssrc",
+        "ssrc:",
+        "ssrc:1",
+        "ssrc:1  ",
+        "ssrc:1 :value",
+        "ssrc:4294967296 cname:x",
+        "ssrc:-1 cname:x"
+    };
+    SdpAttribute_t attribute;
+    SdpSsrc_t ssrc;
+    size_t i;
+
+    result = SdpDeserializer_ParseAttribute( otherBuffer, strlen( otherBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrc( NULL, &( ssrc ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSsrc( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSsrc( &( attribute ), &( ssrc ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseSsrc( &( attribute ), &( ssrc ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_SSRC, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief ssrc-group with the semantics and SSRC list.
+ */
+void test_SdpDeserializer_ParseSsrcGroup_Pass( void )
+{
+    SdpResult_t result;
+    char buffer[] = "ssrc-group:SIM 1111 2222  4294967295 ";
+    SdpAttribute_t attribute;
+    SdpSsrcGroup_t ssrcGroup;
+
+    result = SdpDeserializer_ParseAttribute( buffer, strlen( buffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrcGroup( &( attribute ), &( ssrcGroup ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "SIM", ssrcGroup.pSemantics, ssrcGroup.semanticsLength );
+    TEST_ASSERT_EQUAL( 3, ssrcGroup.semanticsLength );
+    TEST_ASSERT_EQUAL( 3, ssrcGroup.ssrcCount );
+    TEST_ASSERT_EQUAL( 1111, ssrcGroup.ssrcs[ 0 ] );
+    TEST_ASSERT_EQUAL( 2222, ssrcGroup.ssrcs[ 1 ] );
+    TEST_ASSERT_EQUAL( 4294967295U, ssrcGroup.ssrcs[ 2 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief ssrc-group with bad parameters, a missing or invalid field, or too
+ * many SSRCs.
+ */
+void test_SdpDeserializer_ParseSsrcGroup_Invalid( void )
+{
+    SdpResult_t result;
+    char otherBuffer[] = "ssrc:1 cname:x";
+    char buffer[ 256 ];
+    const char * pTestCases[] =
+    {
+        "ssrc-group",
+        "ssrc-group:",
+        "ssrc-group:FID",
+        "ssrc-group:FID  ",
+        "ssrc-group:FID 1 x",
+        "ssrc-group:FID 1 4294967296"
+    };
+    SdpAttribute_t attribute;
+    SdpSsrcGroup_t ssrcGroup;
+    size_t i, length;
+
+    result = SdpDeserializer_ParseAttribute( otherBuffer, strlen( otherBuffer ), &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrcGroup( NULL, &( ssrcGroup ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSsrcGroup( &( attribute ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseSsrcGroup( &( attribute ), &( ssrcGroup ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    for( i = 0; i < sizeof( pTestCases ) / sizeof( pTestCases[ 0 ] ); i++ )
+    {
+        result = SdpDeserializer_ParseAttribute( pTestCases[ i ], strlen( pTestCases[ i ] ), &( attribute ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_ParseSsrcGroup( &( attribute ), &( ssrcGroup ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_SSRC, result );
+    }
+
+    length = ( size_t ) snprintf( buffer, sizeof( buffer ), "ssrc-group:SIM" );
+
+    for( i = 0; i <= SDP_SSRC_GROUP_MAX_SSRCS; i++ )
+    {
+        length += ( size_t ) snprintf( &( buffer[ length ] ), sizeof( buffer ) - length, " %u", ( unsigned int ) i );
+    }
+
+    result = SdpDeserializer_ParseAttribute( buffer, length, &( attribute ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ParseSsrcGroup( &( attribute ), &( ssrcGroup ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Context or count is NULL, or the context is invalid.
+ */
+void test_SdpDeserializer_IndexMediaSections_BadParams( void )
+{
+    SdpResult_t result;
+    SdpMediaSectionInfo_t sections[ 2 ];
+    size_t sectionCount;
+    char buffer[] = "v=0\r\n";
+
+    result = SdpDeserializer_IndexMediaSections( NULL, sections, 2, &( sectionCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* pStart is NULL. */
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 2, &( sectionCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    deserializerContext.pStart = buffer;
+    deserializerContext.totalLength = strlen( buffer );
+    deserializerContext.currentIndex = deserializerContext.totalLength + 1;
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 2, &( sectionCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    deserializerContext.currentIndex = 0;
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 2, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Extents and line counts of each media section, and reading one
+ * section with its own context.
+ */
+void test_SdpDeserializer_IndexMediaSections_Pass( void )
+{
+    SdpResult_t result;
+    SdpMediaSectionInfo_t sections[ 4 ];
+    size_t sectionCount, valueLength;
+    SdpDeserializerContext_t sectionContext;
+    const char * pValue;
+    uint8_t type;
+    char buffer[] = "v=0\r\n"
+                    "o=- 1 2 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "t=0 0\r\n"
+                    "a=group:BUNDLE 0 1\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "c=IN IP4 0.0.0.0\r\n"
+                    "b=AS:64\r\n"
+                    "a=mid:0\r\n"
+                    "a=candidate:1 1 udp 2113937151 192.168.1.100 51372 typ host\r\n"
+                    "a=candidate:2 1 udp 1677729535 203.0.113.7 61665 typ srflx raddr 192.168.1.100 rport 51372\r\n"
+                    "a=end-of-candidates\r\n"
+                    "m=application 9 UDP/DTLS/SCTP webrtc-datachannel\n"
+                    "a=mid:1\n";
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 4, &( sectionCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, sectionCount );
+
+    TEST_ASSERT_EQUAL_STRING_LEN( "m=audio", &( buffer[ sections[ 0 ].startOffset ] ), 7 );
+    TEST_ASSERT_EQUAL_PTR( strstr( buffer, "m=application" ), &( buffer[ sections[ 0 ].endOffset ] ) );
+    TEST_ASSERT_EQUAL( 4, sections[ 0 ].attributeCount );
+    TEST_ASSERT_EQUAL( 1, sections[ 0 ].bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 1, sections[ 0 ].connectionInfoCount );
+    TEST_ASSERT_EQUAL( 2, sections[ 0 ].candidateCount );
+
+    TEST_ASSERT_EQUAL( sections[ 0 ].endOffset, sections[ 1 ].startOffset );
+    TEST_ASSERT_EQUAL( strlen( buffer ), sections[ 1 ].endOffset );
+    TEST_ASSERT_EQUAL( 1, sections[ 1 ].attributeCount );
+    TEST_ASSERT_EQUAL( 0, sections[ 1 ].bandwidthInfoCount );
+    TEST_ASSERT_EQUAL( 0, sections[ 1 ].connectionInfoCount );
+    TEST_ASSERT_EQUAL( 0, sections[ 1 ].candidateCount );
+
+    /* The context is not moved. */
+    TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+
+    /* Read the second section only. */
+    result = SdpDeserializer_Init( &( sectionContext ),
+                                   &( buffer[ sections[ 1 ].startOffset ] ),
+                                   sections[ 1 ].endOffset - sections[ 1 ].startOffset );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNext( &( sectionContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_MEDIA, type );
+
+    result = SdpDeserializer_GetNext( &( sectionContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "mid:1", pValue, valueLength );
+
+    result = SdpDeserializer_GetNext( &( sectionContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Sections are counted when no array is provided, OUT_OF_MEMORY is
+ * returned when the array is too small, and malformed lines are reported.
+ */
+void test_SdpDeserializer_IndexMediaSections_CountAndErrors( void )
+{
+    SdpResult_t result;
+    SdpMediaSectionInfo_t sections[ 1 ];
+    size_t sectionCount;
+    char buffer[] = "v=0\r\nm=audio 9 RTP/AVP 0\r\na=sendrecv\r\nm=video 9 RTP/AVP 96\r\n";
+    char noSections[] = "v=0\r\ns=-\r\n";
+    char malformed[] = "v=0\r\nm=audio 9 RTP/AVP 0\r\na=\r\n";
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), NULL, 0, &( sectionCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, sectionCount );
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 1, &( sectionCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 2, sectionCount );
+    TEST_ASSERT_EQUAL( 5, sections[ 0 ].startOffset );
+    TEST_ASSERT_EQUAL( 1, sections[ 0 ].attributeCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "m=video", &( buffer[ sections[ 0 ].endOffset ] ), 7 );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), noSections, strlen( noSections ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 1, &( sectionCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, sectionCount );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), malformed, strlen( malformed ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_IndexMediaSections( &( deserializerContext ), sections, 1, &( sectionCount ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of the streaming deserializer.
+ */
+void test_SdpDeserializer_Stream_BadParams( void )
+{
+    SdpResult_t result;
+    SdpStreamDeserializerContext_t streamContext;
+    char carryBuffer[ 16 ];
+    char chunk[] = "v=0\r\ns=";
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    result = SdpDeserializer_StreamInit( NULL, carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), NULL, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamFeed( NULL, chunk, strlen( chunk ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), NULL, strlen( chunk ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamGetNext( NULL, &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), NULL, &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), NULL, &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamFinish( NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* A chunk cannot be replaced before it is consumed. */
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk, strlen( chunk ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk, strlen( chunk ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Complete lines point into the chunk and a line split across chunks
+ * is returned from the carry buffer.
+ */
+void test_SdpDeserializer_Stream_SplitLines( void )
+{
+    SdpResult_t result;
+    SdpStreamDeserializerContext_t streamContext;
+    char carryBuffer[ 32 ];
+    char chunk1[] = "v=0\r\ns=-\r\na=ice-";
+    char chunk2[] = "ufrag:";
+    char chunk3[] = "abcd\r\nt=0 0\r\n";
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    /* Nothing fed yet. */
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk1, strlen( chunk1 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_VERSION, type );
+    TEST_ASSERT_EQUAL_PTR( &( chunk1[ 2 ] ), pValue );
+    TEST_ASSERT_EQUAL( 1, valueLength );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "-", pValue, valueLength );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk2, strlen( chunk2 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    /* Bytes without a line ending are still pending. */
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NEWLINE_NOT_FOUND, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), chunk3, strlen( chunk3 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ATTRIBUTE, type );
+    TEST_ASSERT_EQUAL_PTR( &( carryBuffer[ 2 ] ), pValue );
+    TEST_ASSERT_EQUAL_STRING_LEN( "ice-ufrag:abcd", pValue, valueLength );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_TIME_ACTIVE, type );
+    TEST_ASSERT_EQUAL_PTR( &( chunk3[ 8 ] ), pValue );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0 0", pValue, valueLength );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Feeding one byte at a time returns the same lines and errors as
+ * SdpDeserializer_GetNext on the whole message.
+ */
+void test_SdpDeserializer_Stream_ByteByByte( void )
+{
+    SdpResult_t result, expectedResult;
+    SdpStreamDeserializerContext_t streamContext;
+    char carryBuffer[ 64 ];
+    char buffer[] = "v=0\r\no=- 1 2 IN IP4 127.0.0.1\r\ns=-\nt=0 0\r\nm=audio 9 UDP/TLS/RTP/SAVPF 111\r\na=rtpmap:111 opus/48000/2\r\nb\r\n";
+    uint8_t type, expectedType;
+    const char * pValue, * pExpectedValue;
+    size_t valueLength, expectedValueLength, i, lineCount = 0;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    for( i = 0; i < strlen( buffer ); i++ )
+    {
+        result = SdpDeserializer_StreamFeed( &( streamContext ), &( buffer[ i ] ), 1 );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+
+        if( result != SDP_RESULT_MESSAGE_END )
+        {
+            expectedResult = SdpDeserializer_GetNext( &( deserializerContext ), &( expectedType ), &( pExpectedValue ), &( expectedValueLength ) );
+            TEST_ASSERT_EQUAL( expectedResult, result );
+
+            if( result == SDP_RESULT_OK )
+            {
+                TEST_ASSERT_EQUAL( expectedType, type );
+                TEST_ASSERT_EQUAL_STRING_LEN( pExpectedValue, pValue, expectedValueLength );
+                TEST_ASSERT_EQUAL( expectedValueLength, valueLength );
+                lineCount++;
+            }
+
+            result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+            TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+        }
+    }
+
+    /* Six good lines, then "b\r\n" is rejected like SdpDeserializer_GetNext does. */
+    TEST_ASSERT_EQUAL( 6, lineCount );
+    TEST_ASSERT_EQUAL( strlen( buffer ) - 3U, deserializerContext.currentIndex );
+
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A line longer than the carry buffer returns OUT_OF_MEMORY, and
+ * SdpDeserializer_StreamFinish classifies a truncated last line.
+ */
+void test_SdpDeserializer_Stream_CarryOverflowAndTruncated( void )
+{
+    SdpResult_t result;
+    SdpStreamDeserializerContext_t streamContext;
+    char carryBuffer[ 8 ];
+    char longLine[] = "v=0\r\ns=a very long session name";
+    char noEqual[] = "ab";
+    char shortLine[] = "v";
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), longLine, strlen( longLine ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), noEqual, strlen( noEqual ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), noEqual, strlen( noEqual ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND, result );
+
+    result = SdpDeserializer_StreamInit( &( streamContext ), carryBuffer, sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamFeed( &( streamContext ), shortLine, strlen( shortLine ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_StreamGetNext( &( streamContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+
+    result = SdpDeserializer_StreamFinish( &( streamContext ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of the segment deserializer.
+ */
+void test_SdpDeserializer_Segments_BadParams( void )
+{
+    SdpResult_t result;
+    SdpSegmentDeserializerContext_t segmentContext;
+    SdpBufferSegment_t segments[ 1 ] = { { NULL, 4 } };
+    char ring[ 8 ];
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    result = SdpDeserializer_InitSegments( NULL, segments, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitSegments( &( segmentContext ), NULL, 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitSegments( &( segmentContext ), segments, 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitRingBuffer( NULL, ring, sizeof( ring ), 0, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitRingBuffer( &( segmentContext ), NULL, sizeof( ring ), 0, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitRingBuffer( &( segmentContext ), ring, sizeof( ring ), sizeof( ring ), 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_InitRingBuffer( &( segmentContext ), ring, sizeof( ring ), 0, sizeof( ring ) + 1U );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_GetNextFromSegments( NULL, &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* An empty message. */
+    result = SdpDeserializer_InitSegments( &( segmentContext ), NULL, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), NULL, &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Lines inside a segment are returned in place, a line split across
+ * segments (including over an empty one) is stitched, and a truncated last
+ * line is reported.
+ */
+void test_SdpDeserializer_Segments_Lines( void )
+{
+    SdpResult_t result;
+    SdpSegmentDeserializerContext_t segmentContext;
+    char segment1[] = "v=0\r\ns=se";
+    char segment2[] = "ssion\r";
+    char segment3[] = "\nt=0 0\r\na=";
+    SdpBufferSegment_t segments[ 4 ];
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    segments[ 0 ].pBuffer = segment1;
+    segments[ 0 ].bufferLength = strlen( segment1 );
+    segments[ 1 ].pBuffer = segment2;
+    segments[ 1 ].bufferLength = strlen( segment2 );
+    segments[ 2 ].pBuffer = NULL;
+    segments[ 2 ].bufferLength = 0;
+    segments[ 3 ].pBuffer = segment3;
+    segments[ 3 ].bufferLength = strlen( segment3 );
+
+    result = SdpDeserializer_InitSegments( &( segmentContext ), segments, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_VERSION, type );
+    TEST_ASSERT_EQUAL_PTR( &( segment1[ 2 ] ), pValue );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, type );
+    TEST_ASSERT_EQUAL_PTR( &( segmentContext.stitchBuffer[ 2 ] ), pValue );
+    TEST_ASSERT_EQUAL_STRING_LEN( "session", pValue, valueLength );
+    TEST_ASSERT_EQUAL( 7, valueLength );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_TIME_ACTIVE, type );
+    TEST_ASSERT_EQUAL_PTR( &( segment3[ 3 ] ), pValue );
+
+    result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A message that wraps around the end of a ring buffer is parsed
+ * without linearizing it.
+ */
+void test_SdpDeserializer_RingBuffer_Wrapped( void )
+{
+    SdpResult_t result;
+    SdpSegmentDeserializerContext_t segmentContext;
+    const char message[] = "v=0\r\ns=-\r\nt=0 0\r\n";
+    char ring[ 24 ];
+    size_t readIndex, i, messageLength = strlen( message ), lineCount;
+    uint8_t type;
+    const char * pValue;
+    size_t valueLength;
+
+    /* Try every start position so each line is split once. */
+    for( readIndex = 0; readIndex < sizeof( ring ); readIndex++ )
+    {
+        for( i = 0; i < messageLength; i++ )
+        {
+            ring[ ( readIndex + i ) % sizeof( ring ) ] = message[ i ];
+        }
+
+        result = SdpDeserializer_InitRingBuffer( &( segmentContext ), ring, sizeof( ring ), readIndex, messageLength );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        lineCount = 0;
+        result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+
+        while( result == SDP_RESULT_OK )
+        {
+            lineCount++;
+            result = SdpDeserializer_GetNextFromSegments( &( segmentContext ), &( type ), &( pValue ), &( valueLength ) );
+        }
+
+        TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+        TEST_ASSERT_EQUAL( 3, lineCount );
+        TEST_ASSERT_EQUAL( SDP_TYPE_TIME_ACTIVE, type );
+        TEST_ASSERT_EQUAL_STRING_LEN( "0 0", pValue, valueLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of SdpDeserializer_ParseBatch.
+ */
+void test_SdpDeserializer_ParseBatch_BadParams( void )
+{
+    SdpResult_t result;
+    SdpBatchSlot_t slots[ 1 ];
+
+    result = SdpDeserializer_ParseBatch( NULL, 1, 0, 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseBatch( slots, 1, 0, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ParseBatch( slots, 1, 2, 2 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* An empty batch. */
+    result = SdpDeserializer_ParseBatch( NULL, 0, 0, 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every slot is parsed by exactly one worker, and a bad message only
+ * fails its own slot.
+ */
+void test_SdpDeserializer_ParseBatch_Workers( void )
+{
+    SdpResult_t result;
+    char goodMessage[] = "v=0\r\n"
+                         "o=- 1 7 IN IP4 127.0.0.1\r\n"
+                         "s=-\r\n"
+                         "t=0 0\r\n"
+                         "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                         "a=mid:0\r\n";
+    char badMessage[] = "v=0\r\nx\r\n";
+    SdpBatchSlot_t slots[ 7 ];
+    uint64_t arenaBuffers[ 7 ][ 64 ];
+    SdpArena_t arenas[ 7 ];
+    size_t i;
+
+    for( i = 0; i < 7U; i++ )
+    {
+        result = SdpArena_Init( &( arenas[ i ] ), arenaBuffers[ i ], sizeof( arenaBuffers[ i ] ), NULL, NULL );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+        slots[ i ].pMessage = ( i == 4U ) ? badMessage : goodMessage;
+        slots[ i ].messageLength = ( i == 4U ) ? strlen( badMessage ) : strlen( goodMessage );
+        slots[ i ].pArena = &( arenas[ i ] );
+        slots[ i ].result = SDP_RESULT_BASE;
+    }
+
+    /* Run three workers one after the other. */
+    for( i = 0; i < 3U; i++ )
+    {
+        result = SdpDeserializer_ParseBatch( slots, 7, i, 3 );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    }
+
+    for( i = 0; i < 7U; i++ )
+    {
+        if( i == 4U )
+        {
+            TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_EQUAL_NOT_FOUND, slots[ i ].result );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL( SDP_RESULT_OK, slots[ i ].result );
+            TEST_ASSERT_EQUAL( 7, slots[ i ].session.originator.sessionVersion );
+            TEST_ASSERT_EQUAL( 1, slots[ i ].session.mediaDescriptionCount );
+        }
+    }
+
+    /* A huge worker count parses only the slot of its index. */
+    slots[ 0 ].result = SDP_RESULT_BASE;
+    slots[ 1 ].result = SDP_RESULT_BASE;
+    ( void ) SdpArena_Reset( &( arenas[ 1 ] ) );
+
+    result = SdpDeserializer_ParseBatch( slots, 7, 1, SIZE_MAX );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BASE, slots[ 0 ].result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, slots[ 1 ].result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* What the walk callbacks below have seen. */
+typedef struct WalkRecord
+{
+    uint64_t sessionVersion;
+    size_t mediaCount;
+    size_t lastMediaIndex;
+    size_t sessionConnectionInfoCount;
+    size_t attributeCount;
+    SdpAttributeKind_t lastAttributeKind;
+    size_t candidateCount;
+    uint32_t rtpMapClockRate;
+    size_t lineCount;
+    size_t stopAfterMedia;
+} WalkRecord_t;
+
+static SdpResult_t WalkOnOriginator( void * pUserContext,
+                                     const SdpOriginator_t * pOriginator )
+{
+    ( ( WalkRecord_t * ) pUserContext )->sessionVersion = pOriginator->sessionVersion;
+
+    return SDP_RESULT_OK;
+}
+
+static SdpResult_t WalkOnConnectionInfo( void * pUserContext,
+                                         size_t mediaIndex,
+                                         const SdpConnectionInfo_t * pConnInfo )
+{
+    ( void ) pConnInfo;
+
+    if( mediaIndex == SDP_WALK_SESSION_LEVEL )
+    {
+        ( ( WalkRecord_t * ) pUserContext )->sessionConnectionInfoCount++;
+    }
+
+    return SDP_RESULT_OK;
+}
+
+static SdpResult_t WalkOnMedia( void * pUserContext,
+                                size_t mediaIndex,
+                                const SdpMedia_t * pMedia )
+{
+    WalkRecord_t * pRecord = ( WalkRecord_t * ) pUserContext;
+    SdpResult_t result = SDP_RESULT_OK;
+
+    ( void ) pMedia;
+
+    pRecord->mediaCount++;
+    pRecord->lastMediaIndex = mediaIndex;
+
+    if( pRecord->mediaCount == pRecord->stopAfterMedia )
+    {
+        result = SDP_RESULT_MESSAGE_END;
+    }
+
+    return result;
+}
+
+static SdpResult_t WalkOnAttribute( void * pUserContext,
+                                    size_t mediaIndex,
+                                    SdpAttributeKind_t kind,
+                                    const SdpAttribute_t * pAttribute )
+{
+    ( void ) mediaIndex;
+    ( void ) pAttribute;
+
+    ( ( WalkRecord_t * ) pUserContext )->attributeCount++;
+    ( ( WalkRecord_t * ) pUserContext )->lastAttributeKind = kind;
+
+    return SDP_RESULT_OK;
+}
+
+static SdpResult_t WalkOnCandidate( void * pUserContext,
+                                    size_t mediaIndex,
+                                    const SdpIceCandidate_t * pCandidate )
+{
+    ( void ) mediaIndex;
+    ( void ) pCandidate;
+
+    ( ( WalkRecord_t * ) pUserContext )->candidateCount++;
+
+    return SDP_RESULT_OK;
+}
+
+static SdpResult_t WalkOnRtpMap( void * pUserContext,
+                                 size_t mediaIndex,
+                                 const SdpRtpMap_t * pRtpMap )
+{
+    ( void ) mediaIndex;
+
+    ( ( WalkRecord_t * ) pUserContext )->rtpMapClockRate = pRtpMap->clockRate;
+
+    return SDP_RESULT_OK;
+}
+
+static SdpResult_t WalkOnLine( void * pUserContext,
+                               size_t mediaIndex,
+                               uint8_t type,
+                               const char * pValue,
+                               size_t valueLength )
+{
+    ( void ) mediaIndex;
+    ( void ) type;
+    ( void ) pValue;
+    ( void ) valueLength;
+
+    ( ( WalkRecord_t * ) pUserContext )->lineCount++;
+
+    return SDP_RESULT_OK;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of SdpDeserializer_Walk.
+ */
+void test_SdpDeserializer_Walk_BadParams( void )
+{
+    SdpResult_t result;
+    SdpVisitor_t visitor;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+
+    result = SdpDeserializer_Walk( NULL, &( visitor ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_Walk( &( deserializerContext ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every line reaches its typed callback with the media index, and
+ * attributes without a typed callback go to onAttribute.
+ */
+void test_SdpDeserializer_Walk_Callbacks( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "o=- 1 42 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "c=IN IP4 224.2.17.12\r\n"
+                    "t=0 0\r\n"
+                    "a=group:BUNDLE 0 1\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "c=IN IP4 0.0.0.0\r\n"
+                    "a=rtpmap:111 opus/48000/2\r\n"
+                    "a=candidate:1 1 udp 2122260223 192.168.1.2 54321 typ host\r\n"
+                    "m=video 9 UDP/TLS/RTP/SAVPF 96\r\n"
+                    "a=fmtp:96 profile-level-id=42e01f\r\n"
+                    "a=mid:1\r\n";
+    SdpVisitor_t visitor;
+    WalkRecord_t record;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+    memset( &( record ), 0, sizeof( record ) );
+    visitor.onOriginator = WalkOnOriginator;
+    visitor.onConnectionInfo = WalkOnConnectionInfo;
+    visitor.onMedia = WalkOnMedia;
+    visitor.onAttribute = WalkOnAttribute;
+    visitor.onCandidate = WalkOnCandidate;
+    visitor.onRtpMap = WalkOnRtpMap;
+    visitor.onLine = WalkOnLine;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Walk( &( deserializerContext ), &( visitor ), &( record ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( buffer ), deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 42, record.sessionVersion );
+    TEST_ASSERT_EQUAL( 1, record.sessionConnectionInfoCount );
+    TEST_ASSERT_EQUAL( 2, record.mediaCount );
+    TEST_ASSERT_EQUAL( 1, record.lastMediaIndex );
+    TEST_ASSERT_EQUAL( 48000, record.rtpMapClockRate );
+    TEST_ASSERT_EQUAL( 1, record.candidateCount );
+    /* "group", "fmtp" (no onFmtp) and "mid". */
+    TEST_ASSERT_EQUAL( 3, record.attributeCount );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_MID, record.lastAttributeKind );
+    /* "v=" and "s="; "t=" has no onTimeActive and is skipped. */
+    TEST_ASSERT_EQUAL( 2, record.lineCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A callback stops the walk, and a parse error is returned.
+ */
+void test_SdpDeserializer_Walk_StopAndErrors( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "a=mid:0\r\n"
+                    "m=video 9 UDP/TLS/RTP/SAVPF 96\r\n"
+                    "a=mid:1\r\n";
+    char badRtpMap[] = "v=0\r\na=rtpmap:x opus/48000\r\n";
+    SdpVisitor_t visitor;
+    WalkRecord_t record;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+    memset( &( record ), 0, sizeof( record ) );
+    visitor.onMedia = WalkOnMedia;
+    visitor.onAttribute = WalkOnAttribute;
+    record.stopAfterMedia = 1;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Walk( &( deserializerContext ), &( visitor ), &( record ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, record.mediaCount );
+    TEST_ASSERT_EQUAL( 0, record.lastMediaIndex );
+    TEST_ASSERT_EQUAL( 0, record.attributeCount );
+
+    visitor.onRtpMap = WalkOnRtpMap;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), badRtpMap, strlen( badRtpMap ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_Walk( &( deserializerContext ), &( visitor ), &( record ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_RTPMAP, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of SdpDeserializer_WalkSelected.
+ */
+void test_SdpDeserializer_WalkSelected_BadParams( void )
+{
+    SdpResult_t result;
+    SdpVisitor_t visitor;
+    SdpParseMask_t mask;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+    memset( &( mask ), 0, sizeof( mask ) );
+
+    result = SdpDeserializer_WalkSelected( NULL, &( visitor ), NULL, &( mask ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), NULL, NULL, &( mask ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), &( visitor ), NULL, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Only selected lines are visited, and the walk stops once "o=",
+ * "a=ice-ufrag" and "a=ice-pwd" have been found.
+ */
+void test_SdpDeserializer_WalkSelected_StopsWhenFound( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "o=- 1 3 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "t=0 0\r\n"
+                    "a=group:BUNDLE 0 1\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "a=mid:0\r\n"
+                    "a=ice-ufrag:abcd\r\n"
+                    "a=ice-pwd:0123456789abcdef01234567\r\n"
+                    "a=candidate:1 1 udp 2122260223 192.168.1.2 54321 typ host\r\n"
+                    "m=video 9 UDP/TLS/RTP/SAVPF 96\r\n"
+                    "a=mid:1\r\n";
+    const char * pStop = strstr( buffer, "a=candidate" );
+    SdpVisitor_t visitor;
+    SdpParseMask_t mask;
+    WalkRecord_t record;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+    memset( &( record ), 0, sizeof( record ) );
+    visitor.onOriginator = WalkOnOriginator;
+    visitor.onMedia = WalkOnMedia;
+    visitor.onAttribute = WalkOnAttribute;
+    visitor.onCandidate = WalkOnCandidate;
+    visitor.onLine = WalkOnLine;
+
+    mask.lineTypes = SDP_LINE_TYPE_BIT( SDP_TYPE_ORIGINATOR );
+    mask.attributeKinds = SDP_ATTRIBUTE_KIND_BIT( SDP_ATTRIBUTE_KIND_ICE_UFRAG ) |
+                          SDP_ATTRIBUTE_KIND_BIT( SDP_ATTRIBUTE_KIND_ICE_PWD );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), &( visitor ), &( record ), &( mask ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( ( size_t ) ( pStop - buffer ), deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 3, record.sessionVersion );
+    TEST_ASSERT_EQUAL( 0, record.mediaCount );
+    TEST_ASSERT_EQUAL( 0, record.lineCount );
+    TEST_ASSERT_EQUAL( 0, record.candidateCount );
+    TEST_ASSERT_EQUAL( 2, record.attributeCount );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_ICE_PWD, record.lastAttributeKind );
+
+    /* A missing item walks to the end. The media index is still tracked. */
+    memset( &( record ), 0, sizeof( record ) );
+    mask.lineTypes = SDP_LINE_TYPE_BIT( SDP_TYPE_MEDIA ) | SDP_LINE_TYPE_BIT( SDP_TYPE_ENCRYPTION_KEY );
+    mask.attributeKinds = 0;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), &( visitor ), &( record ), &( mask ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( buffer ), deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 2, record.mediaCount );
+    TEST_ASSERT_EQUAL( 1, record.lastMediaIndex );
+    TEST_ASSERT_EQUAL( 0, record.sessionVersion );
+    TEST_ASSERT_EQUAL( 0, record.attributeCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The "a" bit of lineTypes does not keep the walk going once the
+ * selected lines and attribute kinds have been found.
+ */
+void test_SdpDeserializer_WalkSelected_AttributeLineTypeIgnored( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "o=- 1 3 IN IP4 127.0.0.1\r\n"
+                    "s=-\r\n"
+                    "a=ice-ufrag:abcd\r\n"
+                    "a=ice-pwd:0123456789abcdef01234567\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n";
+    const char * pStop = strstr( buffer, "a=ice-pwd" );
+    SdpVisitor_t visitor;
+    SdpParseMask_t mask;
+    WalkRecord_t record;
+
+    memset( &( visitor ), 0, sizeof( visitor ) );
+    memset( &( record ), 0, sizeof( record ) );
+    visitor.onOriginator = WalkOnOriginator;
+    visitor.onAttribute = WalkOnAttribute;
+
+    mask.lineTypes = SDP_LINE_TYPE_BIT( SDP_TYPE_ORIGINATOR ) | SDP_LINE_TYPE_BIT( SDP_TYPE_ATTRIBUTE );
+    mask.attributeKinds = SDP_ATTRIBUTE_KIND_BIT( SDP_ATTRIBUTE_KIND_ICE_UFRAG );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), &( visitor ), &( record ), &( mask ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( ( size_t ) ( pStop - buffer ), deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 3, record.sessionVersion );
+    TEST_ASSERT_EQUAL( 1, record.attributeCount );
+    TEST_ASSERT_EQUAL( SDP_ATTRIBUTE_KIND_ICE_UFRAG, record.lastAttributeKind );
+
+    /* With only the "a" bit set, the walk stops after the first line. */
+    memset( &( record ), 0, sizeof( record ) );
+    mask.lineTypes = SDP_LINE_TYPE_BIT( SDP_TYPE_ATTRIBUTE );
+    mask.attributeKinds = 0;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_WalkSelected( &( deserializerContext ), &( visitor ), &( record ), &( mask ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 5, deserializerContext.currentIndex );
+    TEST_ASSERT_EQUAL( 0, record.attributeCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of SdpDeserializer_ScanPrefixes.
+ */
+void test_SdpDeserializer_ScanPrefixes_BadParams( void )
+{
+    SdpResult_t result;
+    SdpScanPattern_t patterns[ 1 ] = { { "a=mid:", 6 } };
+    SdpScanPattern_t emptyPattern[ 1 ] = { { "", 0 } };
+    size_t matchCount;
+    char buffer[] = "v=0\r\n";
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ScanPrefixes( NULL, patterns, 1, NULL, 0, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), NULL, 1, NULL, 0, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 0, NULL, 0, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 1, NULL, 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), emptyPattern, 1, NULL, 0, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Lines are matched at line starts only, in message order, with the
+ * line ending removed, and the count follows the IndexLines contract.
+ */
+void test_SdpDeserializer_ScanPrefixes_Matches( void )
+{
+    SdpResult_t result;
+    char buffer[] = "v=0\r\n"
+                    "s=a=ice-ufrag:not-a-line-start\r\n"
+                    "a=ice-ufrag:abcd\r\n"
+                    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                    "a=candidate:1 1 udp 2122260223 192.168.1.2 54321 typ host\n"
+                    "a=candidate:2 1 udp 2122260223 192.168.1.3 54321 typ host\r\n"
+                    "a=ice-pwd:\r\n"
+                    "a=fingerprint:sha-256 AB:CD";
+    SdpScanPattern_t patterns[ 4 ] =
+    {
+        { "a=ice-ufrag:",   12 },
+        { "a=ice-pwd:",     10 },
+        { "a=candidate:",   12 },
+        { "a=fingerprint:", 14 }
+    };
+    SdpScanMatch_t matches[ 6 ];
+    size_t matchCount;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 4, NULL, 0, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 5, matchCount );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 4, matches, 6, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 5, matchCount );
+    TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+
+    TEST_ASSERT_EQUAL( 0, matches[ 0 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "a=ice-ufrag:abcd", matches[ 0 ].pLine, matches[ 0 ].lineLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "abcd", matches[ 0 ].pValue, matches[ 0 ].valueLength );
+    TEST_ASSERT_EQUAL( 4, matches[ 0 ].valueLength );
+
+    TEST_ASSERT_EQUAL( 2, matches[ 1 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1 1 udp 2122260223 192.168.1.2 54321 typ host", matches[ 1 ].pValue, matches[ 1 ].valueLength );
+    TEST_ASSERT_EQUAL( 2, matches[ 2 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "2 1 udp 2122260223 192.168.1.3 54321 typ host", matches[ 2 ].pValue, matches[ 2 ].valueLength );
+
+    TEST_ASSERT_EQUAL( 1, matches[ 3 ].patternIndex );
+    TEST_ASSERT_EQUAL( 0, matches[ 3 ].valueLength );
+
+    /* The last line has no line ending. */
+    TEST_ASSERT_EQUAL( 3, matches[ 4 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "sha-256 AB:CD", matches[ 4 ].pValue, matches[ 4 ].valueLength );
+    TEST_ASSERT_EQUAL( 13, matches[ 4 ].valueLength );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 4, matches, 2, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 5, matchCount );
+    TEST_ASSERT_EQUAL( 2, matches[ 1 ].patternIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A line that fits several patterns matches the longest one, or the
+ * first of equal ones, whatever the order of the patterns.
+ */
+void test_SdpDeserializer_ScanPrefixes_Overlapping( void )
+{
+    SdpResult_t result;
+    char buffer[] = "a=ssrc-group:FID 1 2\r\n"
+                    "a=ssrc:1 cname:x\r\n"
+                    "a=sendrecv\r\n"
+                    "a=ssrc";
+    SdpScanPattern_t patterns[ 3 ] =
+    {
+        { "a=ssrc",        6 },
+        { "a=ssrc-group:", 13 },
+        { "a=ssrc-group:", 13 }
+    };
+    SdpScanPattern_t mixedPatterns[ 2 ] =
+    {
+        { "m=",            2 },
+        { "a=ssrc:",       7 }
+    };
+    SdpScanMatch_t matches[ 4 ];
+    size_t matchCount;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), buffer, strlen( buffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), patterns, 3, matches, 4, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, matchCount );
+    TEST_ASSERT_EQUAL( 1, matches[ 0 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "FID 1 2", matches[ 0 ].pValue, matches[ 0 ].valueLength );
+    TEST_ASSERT_EQUAL( 0, matches[ 1 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( ":1 cname:x", matches[ 1 ].pValue, matches[ 1 ].valueLength );
+    /* The last line is exactly the shortest pattern. */
+    TEST_ASSERT_EQUAL( 0, matches[ 2 ].patternIndex );
+    TEST_ASSERT_EQUAL( 0, matches[ 2 ].valueLength );
+
+    /* Patterns with no shared prefix. */
+    result = SdpDeserializer_ScanPrefixes( &( deserializerContext ), mixedPatterns, 2, matches, 4, &( matchCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, matchCount );
+    TEST_ASSERT_EQUAL( 1, matches[ 0 ].patternIndex );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1 cname:x", matches[ 0 ].pValue, matches[ 0 ].valueLength );
+}
+
+/*-----------------------------------------------------------*/
@@ -27,7 +27,8 @@ list(APPEND mock_define_list
 
 # List the files you would like to test here.
 list(APPEND real_source_files
-            ${MODULE_ROOT_DIR}/source/sdp_deserializer.c )
+            ${MODULE_ROOT_DIR}/source/sdp_deserializer.c
+            ${MODULE_ROOT_DIR}/source/sdp_arena.c )
 
 # List the directories the module under test includes.
 list(APPEND real_include_directories
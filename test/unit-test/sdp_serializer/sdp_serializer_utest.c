@@ -3,6 +3,7 @@
 #include "catch_assert.h"
 
 /* Standard includes. */
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -502,6 +503,54 @@ void test_SdpSerializer_AddU64_OutputBufferNotEnough( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Inputs are valid with the largest uint64_t value.
+ */
+void test_SdpSerializer_AddU64_PassMaxValue( void )
+{
+    SdpResult_t result;
+    char expectOutput[] = "t=18446744073709551615\r\n";
+
+    /* Initialize serializer context. */
+    serializerContext.pStart = &( serializerBuffer[ 0 ] );
+    serializerContext.totalLength = serializerBufferLength;
+    serializerContext.currentIndex = 0;
+
+    result = SdpSerializer_AddU64( &( serializerContext ),
+                                   't',
+                                   UINT64_MAX );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( &( expectOutput ), &( serializerBuffer[ 0 ] ) );
+    TEST_ASSERT_EQUAL( strlen( expectOutput ), serializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The output is written when the line exactly fits with its NULL terminator.
+ */
+void test_SdpSerializer_AddU64_PassExactFit( void )
+{
+    SdpResult_t result;
+    char expectOutput[] = "t=0\r\n";
+
+    /* Initialize serializer context. */
+    serializerContext.pStart = &( serializerBuffer[ 0 ] );
+    serializerContext.totalLength = strlen( expectOutput ) + 1;
+    serializerContext.currentIndex = 0;
+
+    result = SdpSerializer_AddU64( &( serializerContext ),
+                                   't',
+                                   0 );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( &( expectOutput ), &( serializerBuffer[ 0 ] ) );
+    TEST_ASSERT_EQUAL( strlen( expectOutput ), serializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Inputs are valid with IPv4 address.
  */
@@ -545,6 +594,42 @@ void test_SdpSerializer_AddOriginator_PassIPv4( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Inputs are valid without user name.
+ */
+void test_SdpSerializer_AddOriginator_PassNoUserName( void )
+{
+    SdpResult_t result;
+    char expectOutput[] = "o= 1 2 IN IP4 127.0.0.1\r\n";
+    char expectAddr[] = "127.0.0.1";
+    SdpOriginator_t originator;
+
+    /* Initialize serializer context. */
+    serializerContext.pStart = &( serializerBuffer[ 0 ] );
+    serializerContext.totalLength = serializerBufferLength;
+    serializerContext.currentIndex = 0;
+
+    /* Initialize originator. */
+    originator.pUserName = NULL;
+    originator.userNameLength = 0;
+    originator.sessionId = 1;
+    originator.sessionVersion = 2;
+    originator.connectionInfo.networkType = SDP_NETWORK_IN;
+    originator.connectionInfo.addressType = SDP_ADDRESS_IPV4;
+    originator.connectionInfo.pAddress = expectAddr;
+    originator.connectionInfo.addressLength = strlen( expectAddr );
+
+    result = SdpSerializer_AddOriginator( &( serializerContext ),
+                                          'o',
+                                          &( originator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( &( expectOutput ), &( serializerBuffer[ 0 ] ) );
+    TEST_ASSERT_EQUAL( strlen( expectOutput ), serializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Inputs are valid with IPv6 address.
  */
@@ -1617,6 +1702,39 @@ void test_SdpSerializer_AddAttribute_Pass( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Input is valid with an empty attribute value.
+ */
+void test_SdpSerializer_AddAttribute_PassEmptyValue( void )
+{
+    SdpResult_t result;
+    char expectOutput[] = "a=group:\r\n";
+    char expectAttributeName[] = "group";
+    char expectAttributeValue[] = "";
+    SdpAttribute_t attribute;
+
+    /* Initialize serializer context. */
+    serializerContext.pStart = &( serializerBuffer[ 0 ] );
+    serializerContext.totalLength = serializerBufferLength;
+    serializerContext.currentIndex = 0;
+
+    /* Initialize attribute. */
+    attribute.pAttributeName = expectAttributeName;
+    attribute.attributeNameLength = strlen( expectAttributeName );
+    attribute.pAttributeValue = expectAttributeValue;
+    attribute.attributeValueLength = 0;
+
+    result = SdpSerializer_AddAttribute( &( serializerContext ),
+                                         'a',
+                                         &( attribute ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( &( expectOutput ), &( serializerBuffer[ 0 ] ) );
+    TEST_ASSERT_EQUAL( strlen( expectOutput ), serializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Input is valid without attribute value.
  */
@@ -2338,3 +2456,774 @@ void test_SdpSerializer_Finalize_NullContextBuffer( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/* Session description used by the whole-session tests. */
+static SdpConnectionInfo_t testConnectionInfos[ 2 ] =
+{
+    { SDP_NETWORK_IN, SDP_ADDRESS_IPV4, "224.2.17.12", 11 },
+    { SDP_NETWORK_IN, SDP_ADDRESS_IPV6, "::1",         3  }
+};
+static SdpBandwidthInfo_t testBandwidthInfos[ 1 ] =
+{
+    { "AS", 2, 2000 }
+};
+static SdpTimeDescription_t testTimeDescriptions[ 1 ] =
+{
+    { 0, 0 }
+};
+static SdpAttribute_t testAttributes[ 4 ] =
+{
+    { "group",  5, "BUNDLE 0 1",         10 },
+    { "mid",    3, "0",                  1  },
+    { "rtpmap", 6, "111 opus/48000/2",   16 },
+    { "rtcp-mux", 8, NULL,               0  }
+};
+static SdpMediaDescription_t testMediaDescriptions[ 2 ] =
+{
+    {
+        { "audio", 5, 9, 0, "UDP/TLS/RTP/SAVPF", 17, "111", 3 },
+        NULL, 0,
+        &( testConnectionInfos[ 1 ] ), 1,
+        NULL, 0,
+        &( testAttributes[ 1 ] ), 3
+    },
+    {
+        { "video", 5, 49170, 2, "RTP/AVP", 7, "96", 2 },
+        "Main video", 10,
+        NULL, 0,
+        &( testBandwidthInfos[ 0 ] ), 1,
+        NULL, 0
+    }
+};
+
+static void FillTestSession( SdpSessionDescription_t * pSession )
+{
+    memset( pSession, 0, sizeof( SdpSessionDescription_t ) );
+    pSession->version = 0;
+    pSession->originator.pUserName = "-";
+    pSession->originator.userNameLength = 1;
+    pSession->originator.sessionId = 4611731400430051336ULL;
+    pSession->originator.sessionVersion = 2;
+    pSession->originator.connectionInfo.networkType = SDP_NETWORK_IN;
+    pSession->originator.connectionInfo.addressType = SDP_ADDRESS_IPV4;
+    pSession->originator.connectionInfo.pAddress = "127.0.0.1";
+    pSession->originator.connectionInfo.addressLength = 9;
+    pSession->pSessionName = "-";
+    pSession->sessionNameLength = 1;
+    pSession->pConnectionInfos = &( testConnectionInfos[ 0 ] );
+    pSession->connectionInfoCount = 1;
+    pSession->pTimeDescriptions = &( testTimeDescriptions[ 0 ] );
+    pSession->timeDescriptionCount = 1;
+    pSession->pAttributes = &( testAttributes[ 0 ] );
+    pSession->attributeCount = 1;
+    pSession->pMediaDescriptions = &( testMediaDescriptions[ 0 ] );
+    pSession->mediaDescriptionCount = 2;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A whole session description is serialized in order.
+ */
+void test_SdpSerializer_AddSession_Pass( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    const char * pMessage;
+    size_t messageLength;
+    const char * pExpected = "v=0\r\n"
+                             "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+                             "s=-\r\n"
+                             "c=IN IP4 224.2.17.12\r\n"
+                             "t=0 0\r\n"
+                             "a=group:BUNDLE 0 1\r\n"
+                             "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                             "c=IN IP6 ::1\r\n"
+                             "a=mid:0\r\n"
+                             "a=rtpmap:111 opus/48000/2\r\n"
+                             "a=rtcp-mux\r\n"
+                             "m=video 49170/2 RTP/AVP 96\r\n"
+                             "i=Main video\r\n"
+                             "b=AS:2000\r\n";
+
+    FillTestSession( &( session ) );
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( pExpected ), messageLength );
+    TEST_ASSERT_EQUAL_STRING( pExpected, pMessage );
+
+    result = SdpSerializer_AddSession( NULL, &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every line length matches what the matching Add* function appends.
+ */
+void test_SdpSerializer_GetLineLength_MatchesAdd( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    size_t before;
+
+    FillTestSession( &( session ) );
+
+    /* Measure with a NULL buffer. */
+    result = SdpSerializer_Init( &( serializerContext ), NULL, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "name\0junk", 9 ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetBufferLineLength( "name\0junk", 9 ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, UINT32_MAX ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetU32LineLength( UINT32_MAX ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU64( &( serializerContext ), SDP_TYPE_VERSION, 0 ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetU64LineLength( 0 ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU64( &( serializerContext ), SDP_TYPE_VERSION, UINT64_MAX ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetU64LineLength( UINT64_MAX ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddOriginator( &( serializerContext ), SDP_TYPE_ORIGINATOR, &( session.originator ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetOriginatorLineLength( &( session.originator ) ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddConnectionInfo( &( serializerContext ), SDP_TYPE_CONNINFO, &( testConnectionInfos[ 1 ] ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetConnectionInfoLineLength( &( testConnectionInfos[ 1 ] ) ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBandwidthInfo( &( serializerContext ), SDP_TYPE_BANDWIDTH, &( testBandwidthInfos[ 0 ] ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetBandwidthInfoLineLength( &( testBandwidthInfos[ 0 ] ) ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddTimeActive( &( serializerContext ), SDP_TYPE_TIME_ACTIVE, &( testTimeDescriptions[ 0 ] ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetTimeActiveLineLength( &( testTimeDescriptions[ 0 ] ) ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddAttribute( &( serializerContext ), SDP_TYPE_ATTRIBUTE, &( testAttributes[ 3 ] ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetAttributeLineLength( &( testAttributes[ 3 ] ) ) );
+
+    before = serializerContext.currentIndex;
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddMedia( &( serializerContext ), SDP_TYPE_MEDIA, &( testMediaDescriptions[ 1 ].media ) ) );
+    TEST_ASSERT_EQUAL( serializerContext.currentIndex - before, SdpSerializer_GetMediaLineLength( &( testMediaDescriptions[ 1 ].media ) ) );
+
+    TEST_ASSERT_EQUAL( 0, SdpSerializer_GetOriginatorLineLength( NULL ) );
+    TEST_ASSERT_EQUAL( 0, SdpSerializer_GetMediaLineLength( NULL ) );
+    TEST_ASSERT_EQUAL( 0, SdpSerializer_GetSessionBufferLength( NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The session buffer length is exact: the session fits in a buffer
+ * of that size and not in one byte less.
+ */
+void test_SdpSerializer_GetSessionBufferLength_Exact( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    size_t bufferLength;
+    const char * pMessage;
+    size_t messageLength;
+
+    FillTestSession( &( session ) );
+    bufferLength = SdpSerializer_GetSessionBufferLength( &( session ) );
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, bufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( bufferLength - 1U, messageLength );
+    TEST_ASSERT_EQUAL( '\0', pMessage[ messageLength ] );
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, bufferLength - 1U );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* State of the test grow callback. */
+typedef struct GrowRecord
+{
+    size_t callCount;
+    size_t failAfter;
+    size_t lastLength;
+} GrowRecord_t;
+
+static char * GrowWithRealloc( void * pGrowContext,
+                               char * pBuffer,
+                               size_t newLength )
+{
+    GrowRecord_t * pRecord = ( GrowRecord_t * ) pGrowContext;
+    char * pNewBuffer = NULL;
+
+    if( pRecord->callCount < pRecord->failAfter )
+    {
+        pNewBuffer = realloc( pBuffer, newLength );
+        pRecord->lastLength = newLength;
+    }
+
+    pRecord->callCount++;
+
+    return pNewBuffer;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of SdpSerializer_InitGrowable.
+ */
+void test_SdpSerializer_InitGrowable_BadParams( void )
+{
+    SdpResult_t result;
+    GrowRecord_t record;
+
+    result = SdpSerializer_InitGrowable( NULL, NULL, 0, GrowWithRealloc, &( record ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_InitGrowable( &( serializerContext ), NULL, 0, NULL, &( record ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_InitGrowable( &( serializerContext ), NULL, 16, GrowWithRealloc, &( record ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* A plain Init clears the callback. */
+    serializerContext.growCallback = GrowWithRealloc;
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( NULL, serializerContext.growCallback );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A growable buffer that starts empty is grown geometrically and
+ * keeps every line already written.
+ */
+void test_SdpSerializer_InitGrowable_Grows( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    GrowRecord_t record = { 0, SIZE_MAX, 0 };
+    const char * pMessage;
+    size_t messageLength, i;
+
+    FillTestSession( &( session ) );
+
+    /* Serialize the session into a fixed buffer for reference. */
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_InitGrowable( &( serializerContext ), NULL, 0, GrowWithRealloc, &( record ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    for( i = 0; i < 3U; i++ )
+    {
+        result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+        TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    }
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3U * strlen( serializerBuffer ), messageLength );
+    TEST_ASSERT_EQUAL( record.lastLength, serializerContext.totalLength );
+    TEST_ASSERT_TRUE( record.callCount < 10U );
+
+    for( i = 0; i < 3U; i++ )
+    {
+        TEST_ASSERT_EQUAL_STRING_LEN( serializerBuffer, &( pMessage[ i * strlen( serializerBuffer ) ] ), strlen( serializerBuffer ) );
+    }
+
+    free( serializerContext.pStart );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A failing grow callback returns OUT_OF_MEMORY and keeps the lines
+ * already written.
+ */
+void test_SdpSerializer_InitGrowable_CallbackFails( void )
+{
+    SdpResult_t result;
+    GrowRecord_t record = { 0, 0, 0 };
+    char buffer[ 8 ];
+    const char * pMessage;
+    size_t messageLength;
+
+    result = SdpSerializer_InitGrowable( &( serializerContext ), buffer, sizeof( buffer ), GrowWithRealloc, &( record ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, record.callCount );
+
+    result = SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "-", 1 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 1, record.callCount );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( buffer, pMessage );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\n", pMessage );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of the gather mode.
+ */
+void test_SdpSerializer_InitGather_BadParams( void )
+{
+    SdpResult_t result;
+    SdpIoVector_t ioVectors[ 4 ];
+    const char * pMessage;
+    size_t ioVectorCount, messageLength;
+
+    result = SdpSerializer_InitGather( NULL, serializerBuffer, serializerBufferLength, ioVectors, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_InitGather( &( serializerContext ), NULL, serializerBufferLength, ioVectors, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_InitGather( &( serializerContext ), serializerBuffer, serializerBufferLength, NULL, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_InitGather( &( serializerContext ), serializerBuffer, serializerBufferLength, ioVectors, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* A flat context cannot be finalized as pieces. */
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_FinalizeGather( &( serializerContext ), &( ioVectorCount ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* And a gather context cannot be finalized as a flat buffer. */
+    result = SdpSerializer_InitGather( &( serializerContext ), serializerBuffer, serializerBufferLength, ioVectors, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_FinalizeGather( &( serializerContext ), NULL, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_FinalizeGather( &( serializerContext ), &( ioVectorCount ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The pieces of a gathered session concatenate to the flat message,
+ * and strings of the caller are referenced instead of copied.
+ */
+void test_SdpSerializer_InitGather_Session( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    SdpIoVector_t ioVectors[ 64 ];
+    char scratch[ 256 ];
+    char gathered[ SDP_TEST_BUFFER_SIZE ];
+    const char * pMessage;
+    size_t ioVectorCount, messageLength, gatheredLength = 0, i;
+    uint8_t valueReferenced = 0;
+
+    FillTestSession( &( session ) );
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_InitGather( &( serializerContext ), scratch, sizeof( scratch ), ioVectors, 64 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_FinalizeGather( &( serializerContext ), &( ioVectorCount ), &( gatheredLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( messageLength, gatheredLength );
+    TEST_ASSERT_TRUE( serializerContext.currentIndex < messageLength );
+
+    gatheredLength = 0;
+
+    for( i = 0; i < ioVectorCount; i++ )
+    {
+        TEST_ASSERT_TRUE( ioVectors[ i ].length > 0U );
+        memcpy( &( gathered[ gatheredLength ] ), ioVectors[ i ].pBase, ioVectors[ i ].length );
+        gatheredLength += ioVectors[ i ].length;
+
+        if( ioVectors[ i ].pBase == testAttributes[ 2 ].pAttributeValue )
+        {
+            valueReferenced = 1;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( messageLength, gatheredLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( pMessage, gathered, messageLength );
+    TEST_ASSERT_EQUAL( 1, valueReferenced );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A line that does not fit in the pieces or in the scratch buffer is
+ * not added at all.
+ */
+void test_SdpSerializer_InitGather_OutOfMemory( void )
+{
+    SdpResult_t result;
+    SdpIoVector_t ioVectors[ 3 ];
+    char scratch[ 16 ];
+    size_t ioVectorCount, messageLength;
+
+    result = SdpSerializer_InitGather( &( serializerContext ), scratch, sizeof( scratch ), ioVectors, 3 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    /* Consecutive copies share one piece. */
+    result = SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    result = SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, serializerContext.ioVectorCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "v=0\r\nv=0\r\n", ioVectors[ 0 ].pBase, 10 );
+
+    /* "s=" extends the first piece, the value and "\r\n" need two more. */
+    result = SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "name", 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, serializerContext.ioVectorCount );
+
+    /* No piece left for the value. */
+    result = SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "name", 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    /* The scratch buffer has 2 bytes left. */
+    result = SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    result = SdpSerializer_FinalizeGather( &( serializerContext ), &( ioVectorCount ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, ioVectorCount );
+    TEST_ASSERT_EQUAL( 18, messageLength );
+    TEST_ASSERT_EQUAL( 14, serializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A skeleton built with the Add* calls renders with the values of its
+ * placeholders, including numbers.
+ */
+void test_SdpSerializer_RenderTemplate_Pass( void )
+{
+    SdpResult_t result;
+    SdpTemplate_t sdpTemplate;
+    SdpTemplatePart_t parts[ 8 ];
+    const char * const placeholderNames[ 3 ] = { "session-version", "port", "ice-ufrag" };
+    SdpTemplateValue_t values[ 3 ] =
+    {
+        { NULL,   0, 42   },
+        { NULL,   0, 9    },
+        { "abcd", 4, 0    }
+    };
+    SdpAttribute_t attribute = { "ice-ufrag", 9, "{ice-ufrag}", 11 };
+    const char * pSkeleton;
+    size_t skeletonLength, partCount, messageLength;
+    char output[ 256 ];
+    const char * pExpected = "v=0\r\n"
+                             "o=- 1 42 IN IP4 127.0.0.1\r\n"
+                             "s={not-a-placeholder}\r\n"
+                             "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                             "a=ice-ufrag:abcd\r\n";
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_ORIGINATOR, "- 1 {session-version} IN IP4 127.0.0.1", 38 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "{not-a-placeholder}", 19 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_MEDIA, "audio {port} UDP/TLS/RTP/SAVPF 111", 34 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddAttribute( &( serializerContext ), SDP_TYPE_ATTRIBUTE, &( attribute ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_Finalize( &( serializerContext ), &( pSkeleton ), &( skeletonLength ) ) );
+
+    /* Count the parts first. */
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), pSkeleton, skeletonLength, placeholderNames, 3, NULL, 0, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, partCount );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), pSkeleton, skeletonLength, placeholderNames, 3, parts, 3, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 4, partCount );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), pSkeleton, skeletonLength, placeholderNames, 3, parts, 8, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, partCount );
+    TEST_ASSERT_EQUAL( 0, parts[ 0 ].placeholderIndex );
+    TEST_ASSERT_EQUAL( 1, parts[ 1 ].placeholderIndex );
+    TEST_ASSERT_EQUAL( 2, parts[ 2 ].placeholderIndex );
+    TEST_ASSERT_EQUAL( SDP_TEMPLATE_NO_PLACEHOLDER, parts[ 3 ].placeholderIndex );
+
+    /* Measure, then render. */
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), values, 3, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( pExpected ), messageLength );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), values, 3, output, messageLength, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), values, 3, output, sizeof( output ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( pExpected, output );
+
+    /* Render again for the next peer. */
+    values[ 0 ].number = 43;
+    values[ 2 ].pValue = "wxyz";
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), values, 3, output, sizeof( output ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_NOT_NULL( strstr( output, "o=- 1 43 IN" ) );
+    TEST_ASSERT_NOT_NULL( strstr( output, "a=ice-ufrag:wxyz\r\n" ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the parameters of the template functions.
+ */
+void test_SdpSerializer_RenderTemplate_BadParams( void )
+{
+    SdpResult_t result;
+    SdpTemplate_t sdpTemplate;
+    SdpTemplatePart_t parts[ 2 ];
+    const char * const placeholderNames[ 2 ] = { "port", NULL };
+    SdpTemplateValue_t value = { NULL, 0, 9 };
+    size_t partCount, messageLength;
+
+    result = SdpSerializer_CompileTemplate( NULL, "m={port}", 8, placeholderNames, 1, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), NULL, 8, placeholderNames, 1, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), "m={port}", 8, NULL, 1, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), "m={port}", 8, placeholderNames, 2, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), "m={port}", 8, placeholderNames, 1, parts, 2, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* A template that was only counted cannot be rendered. */
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), "m={port}", 8, placeholderNames, 1, NULL, 0, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, partCount );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 1, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), "m={port}", 8, placeholderNames, 1, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_RenderTemplate( NULL, &( value ), 1, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), NULL, 1, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 0, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 1, NULL, 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 1, NULL, 0, &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, messageLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The session version is rewritten in place, and the tail only moves
+ * when the width of the field changes.
+ */
+void test_SdpSerializer_SetSessionVersion_Pass( void )
+{
+    SdpResult_t result;
+    SdpSessionDescription_t session;
+    char expected[ SDP_TEST_BUFFER_SIZE ];
+    const char * pMessage;
+    size_t messageLength, expectedLength;
+    uint64_t sessionVersion = 0;
+
+    FillTestSession( &( session ) );
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, serializerBufferLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    expectedLength = messageLength;
+
+    /* 2 -> 3 keeps the width. */
+    result = SdpSerializer_IncrementSessionVersion( serializerBuffer, serializerBufferLength, &( messageLength ), 0, &( sessionVersion ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, sessionVersion );
+    TEST_ASSERT_EQUAL( expectedLength, messageLength );
+
+    /* 3 -> 10 moves the tail by one byte. */
+    result = SdpSerializer_SetSessionVersion( serializerBuffer, serializerBufferLength, &( messageLength ), 10, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( expectedLength + 1U, messageLength );
+
+    session.originator.sessionVersion = 10;
+    result = SdpSerializer_Init( &( serializerContext ), expected, sizeof( expected ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    result = SdpSerializer_AddSession( &( serializerContext ), &( session ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( expected, serializerBuffer );
+
+    /* Reserve the widest field once, later versions never move the tail. */
+    result = SdpSerializer_SetSessionVersion( serializerBuffer, serializerBufferLength, &( messageLength ), 10, 20 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( expectedLength + 19U, messageLength );
+    TEST_ASSERT_NOT_NULL( strstr( serializerBuffer, " 00000000000000000010 IN IP4 " ) );
+
+    /* The reserved width is kept without passing minimumDigits again. */
+    result = SdpSerializer_IncrementSessionVersion( serializerBuffer, serializerBufferLength, &( messageLength ), 0, &( sessionVersion ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 11, sessionVersion );
+    TEST_ASSERT_EQUAL( expectedLength + 19U, messageLength );
+    TEST_ASSERT_NOT_NULL( strstr( serializerBuffer, " 00000000000000000011 IN IP4 " ) );
+    TEST_ASSERT_EQUAL( strlen( serializerBuffer ), messageLength );
+
+    /* A smaller version does not shrink the field either. */
+    result = SdpSerializer_SetSessionVersion( serializerBuffer, serializerBufferLength, &( messageLength ), 2, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( expectedLength + 19U, messageLength );
+    TEST_ASSERT_NOT_NULL( strstr( serializerBuffer, " 00000000000000000002 IN IP4 " ) );
+    TEST_ASSERT_EQUAL_STRING( &( pMessage[ strlen( pMessage ) - 40U ] ), &( serializerBuffer[ messageLength - 40U ] ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A zero-padded version set once keeps its width on every later
+ * increment, so the tail never moves.
+ */
+void test_SdpSerializer_IncrementSessionVersion_Padded( void )
+{
+    SdpResult_t result;
+    char buffer[ 64 ];
+    size_t messageLength;
+    uint64_t sessionVersion = 0;
+
+    strcpy( buffer, "v=0\r\no=- 1 100 IN IP4 127.0.0.1\r\ns=-\r\n" );
+    messageLength = strlen( buffer );
+
+    /* 100 -> 7 keeps three digits. */
+    result = SdpSerializer_SetSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 7, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\no=- 1 007 IN IP4 127.0.0.1\r\ns=-\r\n", buffer );
+
+    result = SdpSerializer_SetSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 5, 20 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\no=- 1 00000000000000000005 IN IP4 127.0.0.1\r\ns=-\r\n", buffer );
+
+    result = SdpSerializer_IncrementSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 0, &( sessionVersion ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 6, sessionVersion );
+    TEST_ASSERT_EQUAL( strlen( buffer ), messageLength );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\no=- 1 00000000000000000006 IN IP4 127.0.0.1\r\ns=-\r\n", buffer );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Errors of the session version rewrite leave the message untouched.
+ */
+void test_SdpSerializer_SetSessionVersion_Errors( void )
+{
+    SdpResult_t result;
+    char buffer[ 64 ];
+    size_t messageLength;
+
+    strcpy( buffer, "v=0\r\no=- 1 9 IN IP4 127.0.0.1\r\n" );
+    messageLength = strlen( buffer );
+
+    result = SdpSerializer_SetSessionVersion( NULL, sizeof( buffer ), &( messageLength ), 1, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_SetSessionVersion( buffer, sizeof( buffer ), NULL, 1, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_SetSessionVersion( buffer, messageLength, &( messageLength ), 1, 0 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSerializer_SetSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 1, 21 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* Only room for the NULL terminator. */
+    result = SdpSerializer_IncrementSessionVersion( buffer, messageLength + 1U, &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\no=- 1 9 IN IP4 127.0.0.1\r\n", buffer );
+
+    result = SdpSerializer_IncrementSessionVersion( buffer, messageLength + 2U, &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( "v=0\r\no=- 1 10 IN IP4 127.0.0.1\r\n", buffer );
+
+    strcpy( buffer, "v=0\r\ns=-\r\n" );
+    messageLength = strlen( buffer );
+    result = SdpSerializer_IncrementSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+
+    strcpy( buffer, "v=0\r\no=- 1 x IN IP4 127.0.0.1\r\n" );
+    messageLength = strlen( buffer );
+    result = SdpSerializer_IncrementSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION, result );
+
+    strcpy( buffer, "o=- 1 18446744073709551615 IN IP4 127.0.0.1\r\n" );
+    messageLength = strlen( buffer );
+    result = SdpSerializer_IncrementSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    strcpy( buffer, "o=- 1 18446744073709551616 IN IP4 127.0.0.1\r\n" );
+    messageLength = strlen( buffer );
+    result = SdpSerializer_IncrementSessionVersion( buffer, sizeof( buffer ), &( messageLength ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_SESSION_VERSION, result );
+}
+
+/*-----------------------------------------------------------*/
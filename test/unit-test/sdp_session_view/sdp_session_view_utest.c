@@ -0,0 +1,340 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+#include "sdp_session_view.h"
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SDP_TEST_ARENA_SIZE ( 4096 )
+
+SdpSessionView_t sessionView;
+SdpDeserializerContext_t deserializerContext;
+SdpArena_t arena;
+uint64_t arenaBuffer[ SDP_TEST_ARENA_SIZE / sizeof( uint64_t ) ];
+
+char offer[] = "v=0\r\n"
+               "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+               "s=-\r\n"
+               "t=0 0\r\n"
+               "a=group:BUNDLE 0 1\r\n"
+               "a=ice-options:trickle\r\n"
+               "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+               "c=IN IP4 0.0.0.0\r\n"
+               "a=ice-ufrag:EsAw\r\n"
+               "a=ice-pwd:P2uYro0UCOQ4zxjKXaWCBui1\r\n"
+               "a=mid:0\r\n"
+               "a=rtpmap:111 opus/48000/2\r\n"
+               "m=video 9 UDP/TLS/RTP/SAVPF 96 97\r\n"
+               "a=mid:1\r\n"
+               "a=rtpmap:96 VP8/90000\r\n"
+               "a=rtpmap:97 rtx/90000\r\n";
+
+void setUp( void )
+{
+    memset( &( sessionView ), 0, sizeof( sessionView ) );
+    memset( &( arenaBuffer[ 0 ] ), 0, sizeof( arenaBuffer ) );
+
+    ( void ) SdpArena_Init( &( arena ), arenaBuffer, sizeof( arenaBuffer ), NULL, NULL );
+    ( void ) SdpDeserializer_Init( &( deserializerContext ), offer, strlen( offer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief NULL inputs to every function.
+ */
+void test_SdpSessionView_BadParams( void )
+{
+    SdpResult_t result;
+    const SdpOriginator_t * pOriginator;
+    const SdpMedia_t * pMedia;
+    SdpAttribute_t attributes[ 2 ];
+    size_t count;
+
+    result = SdpSessionView_Init( NULL, &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_Init( &( sessionView ), NULL, &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    /* The view is not initialized. */
+    result = SdpSessionView_GetOriginator( &( sessionView ), &( pOriginator ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMedia( &( sessionView ), 0, &( pMedia ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_MID, attributes, 2, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_GetOriginator( NULL, &( pOriginator ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetOriginator( &( sessionView ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMediaCount( NULL, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMediaCount( &( sessionView ), NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMedia( NULL, 0, &( pMedia ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMedia( &( sessionView ), 0, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMedia( &( sessionView ), 2, &( pMedia ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetMedia( &( sessionView ), SDP_SESSION_VIEW_SESSION_LEVEL, &( pMedia ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetAttributes( NULL, 0, SDP_ATTRIBUTE_KIND_MID, attributes, 2, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_MID, attributes, 2, NULL );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 2, SDP_ATTRIBUTE_KIND_MID, attributes, 2, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Init only indexes the lines. Fields are parsed and cached on first
+ * access.
+ */
+void test_SdpSessionView_LazyParse( void )
+{
+    SdpResult_t result;
+    const SdpOriginator_t * pOriginator;
+    const SdpOriginator_t * pCachedOriginator;
+    const SdpMedia_t * pMedia;
+    size_t mediaCount, usedAfterInit;
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 16, sessionView.lineCount );
+    TEST_ASSERT_EQUAL( 0, sessionView.parsedFlags );
+    TEST_ASSERT_EQUAL( 6, sessionView.pSections[ 0 ].lineCount );
+    TEST_ASSERT_EQUAL( 6, sessionView.pSections[ 1 ].firstLine );
+    TEST_ASSERT_EQUAL( 6, sessionView.pSections[ 1 ].lineCount );
+    TEST_ASSERT_EQUAL( 12, sessionView.pSections[ 2 ].firstLine );
+    TEST_ASSERT_EQUAL( 4, sessionView.pSections[ 2 ].lineCount );
+
+    /* The context is not moved. */
+    TEST_ASSERT_EQUAL( 0, deserializerContext.currentIndex );
+
+    result = SdpSessionView_GetMediaCount( &( sessionView ), &( mediaCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, mediaCount );
+
+    result = SdpSessionView_GetOriginator( &( sessionView ), &( pOriginator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4611731400430051336ULL, pOriginator->sessionId );
+    TEST_ASSERT_EQUAL( 2, pOriginator->sessionVersion );
+    TEST_ASSERT_EQUAL_STRING_LEN( "127.0.0.1", pOriginator->connectionInfo.pAddress, pOriginator->connectionInfo.addressLength );
+
+    /* The second call returns the cached result. */
+    sessionView.pLines[ 1 ].valueLength = 0;
+    result = SdpSessionView_GetOriginator( &( sessionView ), &( pCachedOriginator ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( pOriginator, pCachedOriginator );
+    TEST_ASSERT_EQUAL( 2, pCachedOriginator->sessionVersion );
+
+    /* Only the requested media section is parsed. */
+    result = SdpSessionView_GetMedia( &( sessionView ), 1, &( pMedia ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "video", pMedia->pMedia, pMedia->mediaLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "96 97", pMedia->pFmt, pMedia->fmtLength );
+    TEST_ASSERT_EQUAL( 0, sessionView.pSections[ 1 ].parsedFlags );
+
+    /* Nothing is allocated after Init until attributes are requested. */
+    usedAfterInit = arena.used;
+
+    result = SdpSessionView_GetMedia( &( sessionView ), 0, &( pMedia ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING_LEN( "audio", pMedia->pMedia, pMedia->mediaLength );
+    TEST_ASSERT_EQUAL( 9, pMedia->port );
+    TEST_ASSERT_EQUAL( usedAfterInit, arena.used );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attributes of one kind, at the session level and in a media
+ * section.
+ */
+void test_SdpSessionView_GetAttributes( void )
+{
+    SdpResult_t result;
+    SdpAttribute_t attributes[ 2 ];
+    size_t count, usedAfterFirstAccess;
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_ICE_UFRAG, attributes, 2, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "EsAw", attributes[ 0 ].pAttributeValue, attributes[ 0 ].attributeValueLength );
+    TEST_ASSERT_EQUAL( 4, attributes[ 0 ].attributeValueLength );
+
+    /* Later calls for the same section use the cache. */
+    usedAfterFirstAccess = arena.used;
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_ICE_PWD, attributes, 2, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "P2uYro0UCOQ4zxjKXaWCBui1", attributes[ 0 ].pAttributeValue, attributes[ 0 ].attributeValueLength );
+    TEST_ASSERT_EQUAL( usedAfterFirstAccess, arena.used );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), SDP_SESSION_VIEW_SESSION_LEVEL, SDP_ATTRIBUTE_KIND_GROUP, attributes, 2, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "BUNDLE 0 1", attributes[ 0 ].pAttributeValue, attributes[ 0 ].attributeValueLength );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 1, SDP_ATTRIBUTE_KIND_RTPMAP, attributes, 2, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "96 VP8/90000", attributes[ 0 ].pAttributeValue, attributes[ 0 ].attributeValueLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "97 rtx/90000", attributes[ 1 ].pAttributeValue, attributes[ 1 ].attributeValueLength );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 1, SDP_ATTRIBUTE_KIND_ICE_UFRAG, attributes, 2, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, count );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Attributes are counted when no array is provided, and
+ * OUT_OF_MEMORY is returned when the array is too small.
+ */
+void test_SdpSessionView_GetAttributes_CountAndOutOfMemory( void )
+{
+    SdpResult_t result;
+    SdpAttribute_t attributes[ 1 ];
+    size_t count;
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 1, SDP_ATTRIBUTE_KIND_RTPMAP, NULL, 0, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, count );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 1, SDP_ATTRIBUTE_KIND_RTPMAP, attributes, 1, &( count ) );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 2, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "96 VP8/90000", attributes[ 0 ].pAttributeValue, attributes[ 0 ].attributeValueLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Errors of the line index, the arena and the parsers are returned.
+ */
+void test_SdpSessionView_Errors( void )
+{
+    SdpResult_t result;
+    const SdpOriginator_t * pOriginator;
+    const SdpMedia_t * pMedia;
+    SdpAttribute_t attributes[ 1 ];
+    size_t count;
+    char malformed[] = "v=0\r\ns=\r\n";
+    char noOriginator[] = "v=0\r\ns=-\r\nm=audio x RTP/AVP 0\r\na=mid:0\r\n";
+    uint64_t smallBuffer[ 4 ];
+
+    result = SdpDeserializer_Init( &( deserializerContext ), malformed, strlen( malformed ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NO_VALUE, result );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), noOriginator, strlen( noOriginator ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSessionView_GetOriginator( &( sessionView ), &( pOriginator ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+
+    result = SdpSessionView_GetMedia( &( sessionView ), 0, &( pMedia ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_INVALID_PORT, result );
+
+    /* The arena is too small for the attributes. */
+    ( void ) SdpArena_Init( &( arena ), smallBuffer, sizeof( smallBuffer ), NULL, NULL );
+    sessionView.pArena = &( arena );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_MID, attributes, 1, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+
+    /* The arena is too small for the line index. */
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A retry after the arena ran out reuses the arrays that were already
+ * allocated.
+ */
+void test_SdpSessionView_GetAttributes_RetryAfterOutOfMemory( void )
+{
+    SdpResult_t result;
+    SdpAttribute_t attributes[ 2 ];
+    size_t count = 0, usedBefore;
+
+    result = SdpSessionView_Init( &( sessionView ), &( deserializerContext ), &( arena ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    /* Media 0 has 4 attributes. Leave room for their array only. */
+    usedBefore = arena.used;
+    arena.bufferLength = arena.used + ( 4U * sizeof( SdpAttribute_t ) );
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_MID, attributes, 2, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( usedBefore + ( 4U * sizeof( SdpAttribute_t ) ), arena.used );
+
+    /* Room for the kinds only is enough for the retry. */
+    arena.bufferLength += 4U * sizeof( SdpAttributeKind_t ) + SDP_ARENA_ALIGNMENT;
+
+    result = SdpSessionView_GetAttributes( &( sessionView ), 0, SDP_ATTRIBUTE_KIND_MID, attributes, 2, &( count ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", attributes[ 0 ].pAttributeValue, 1 );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,234 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+#include "sdp_serializer.h"
+#include "sdp_deserializer.h"
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+/* Built with SDP_TRUSTED_INPUT set to 1, so only well formed input is used
+ * here, except where a check that stays in trusted mode is exercised. */
+
+#define SDP_TEST_BUFFER_SIZE ( 1000 )
+
+SdpSerializerContext_t serializerContext;
+SdpDeserializerContext_t deserializerContext;
+char serializerBuffer[ SDP_TEST_BUFFER_SIZE ];
+
+void setUp( void )
+{
+    memset( &( serializerContext ), 0, sizeof( serializerContext ) );
+    memset( &( deserializerContext ), 0, sizeof( deserializerContext ) );
+    memset( &( serializerBuffer[ 0 ] ), 0, sizeof( serializerBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief The input checks are compiled out in this build.
+ */
+void test_SdpTrustedInput_Enabled( void )
+{
+    TEST_ASSERT_EQUAL( 1, SDP_TRUSTED_INPUT );
+    TEST_ASSERT_EQUAL( 0, SDP_CHECK_INPUT( 1 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Every Add* function writes the same lines as in the checked build.
+ */
+void test_SdpTrustedInput_Serialize( void )
+{
+    SdpResult_t result;
+    SdpOriginator_t originator;
+    SdpConnectionInfo_t connectionInfo = { SDP_NETWORK_IN, SDP_ADDRESS_IPV4, "0.0.0.0", 7 };
+    SdpBandwidthInfo_t bandwidthInfo = { "AS", 2, 2000 };
+    SdpTimeDescription_t timeDescription = { 0, 0 };
+    SdpAttribute_t attribute = { "rtpmap", 6, "111 opus/48000/2", 16 };
+    SdpMedia_t media = { "audio", 5, 9, 0, "UDP/TLS/RTP/SAVPF", 17, "111", 3 };
+    const char * pMessage;
+    size_t messageLength;
+    const char * pExpected = "v=0\r\n"
+                             "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+                             "s=name\r\n"
+                             "t=0 0\r\n"
+                             "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+                             "c=IN IP4 0.0.0.0\r\n"
+                             "b=AS:2000\r\n"
+                             "a=rtpmap:111 opus/48000/2\r\n";
+
+    memset( &( originator ), 0, sizeof( originator ) );
+    originator.pUserName = "-";
+    originator.userNameLength = 1;
+    originator.sessionId = 4611731400430051336ULL;
+    originator.sessionVersion = 2;
+    originator.connectionInfo.networkType = SDP_NETWORK_IN;
+    originator.connectionInfo.addressType = SDP_ADDRESS_IPV4;
+    originator.connectionInfo.pAddress = "127.0.0.1";
+    originator.connectionInfo.addressLength = 9;
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, sizeof( serializerBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddOriginator( &( serializerContext ), SDP_TYPE_ORIGINATOR, &( originator ) ) );
+    /* BoundedLength trusts the length in this build. */
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "name", 4 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddTimeActive( &( serializerContext ), SDP_TYPE_TIME_ACTIVE, &( timeDescription ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddMedia( &( serializerContext ), SDP_TYPE_MEDIA, &( media ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddConnectionInfo( &( serializerContext ), SDP_TYPE_CONNINFO, &( connectionInfo ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBandwidthInfo( &( serializerContext ), SDP_TYPE_BANDWIDTH, &( bandwidthInfo ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddAttribute( &( serializerContext ), SDP_TYPE_ATTRIBUTE, &( attribute ) ) );
+
+    result = SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( strlen( pExpected ), messageLength );
+    TEST_ASSERT_EQUAL_STRING( pExpected, pMessage );
+
+    /* The output capacity is still checked. */
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, 4 );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OUT_OF_MEMORY, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "name", 4 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A NULL character inside the given length is written, where the
+ * checked build stops the value at it.
+ */
+void test_SdpTrustedInput_EmbeddedNull( void )
+{
+    SdpResult_t result;
+    const char * pMessage;
+    size_t messageLength;
+    const char expected[] = { 's', '=', 'a', '\0', 'b', '\r', '\n' };
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, sizeof( serializerBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "a\0b", 3 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) ) );
+
+    TEST_ASSERT_EQUAL( sizeof( expected ), messageLength );
+    TEST_ASSERT_EQUAL_MEMORY( expected, pMessage, sizeof( expected ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief GetNext returns every line of a serialized message.
+ */
+void test_SdpTrustedInput_RoundTrip( void )
+{
+    SdpResult_t result;
+    SdpOriginator_t originator;
+    const char * pMessage;
+    const char * pValue;
+    size_t messageLength, valueLength;
+    uint8_t type;
+
+    memset( &( originator ), 0, sizeof( originator ) );
+    originator.pUserName = "-";
+    originator.userNameLength = 1;
+    originator.sessionId = 1;
+    originator.sessionVersion = 18446744073709551615ULL;
+    originator.connectionInfo.networkType = SDP_NETWORK_IN;
+    originator.connectionInfo.addressType = SDP_ADDRESS_IPV6;
+    originator.connectionInfo.pAddress = "::1";
+    originator.connectionInfo.addressLength = 3;
+
+    result = SdpSerializer_Init( &( serializerContext ), serializerBuffer, sizeof( serializerBuffer ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddU32( &( serializerContext ), SDP_TYPE_VERSION, 0 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddOriginator( &( serializerContext ), SDP_TYPE_ORIGINATOR, &( originator ) ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_AddBuffer( &( serializerContext ), SDP_TYPE_SESSION_NAME, "-", 1 ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpSerializer_Finalize( &( serializerContext ), &( pMessage ), &( messageLength ) ) );
+
+    result = SdpDeserializer_Init( &( deserializerContext ), pMessage, messageLength );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_VERSION, type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", pValue, valueLength );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_ORIGINATOR, type );
+    memset( &( originator ), 0, sizeof( originator ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, SdpDeserializer_ParseOriginator( pValue, valueLength, &( originator ) ) );
+    TEST_ASSERT_EQUAL( 18446744073709551615ULL, originator.sessionVersion );
+    TEST_ASSERT_EQUAL( SDP_ADDRESS_IPV6, originator.connectionInfo.addressType );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_SESSION_NAME, type );
+    TEST_ASSERT_EQUAL_STRING_LEN( "-", pValue, valueLength );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A stray byte after the last line still stops GetNext before the
+ * newline search, which would otherwise run past the message.
+ */
+void test_SdpTrustedInput_GetNext_TrailingByte( void )
+{
+    SdpResult_t result;
+    char message[] = { 'v', '=', '0', '\r', '\n', '\n' };
+    const char * pValue;
+    size_t valueLength;
+    uint8_t type;
+
+    result = SdpDeserializer_Init( &( deserializerContext ), message, sizeof( message ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( SDP_TYPE_VERSION, type );
+
+    result = SdpDeserializer_GetNext( &( deserializerContext ), &( type ), &( pValue ), &( valueLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_MESSAGE_MALFORMED_NOT_ENOUGH_INFO, result );
+    TEST_ASSERT_EQUAL( 5, deserializerContext.currentIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief A template renders with its values, and a value array shorter than
+ * the placeholders is still rejected.
+ */
+void test_SdpTrustedInput_RenderTemplate( void )
+{
+    SdpResult_t result;
+    SdpTemplate_t sdpTemplate;
+    SdpTemplatePart_t parts[ 2 ];
+    const char * const placeholderNames[ 1 ] = { "port" };
+    SdpTemplateValue_t value = { NULL, 0, 9 };
+    const char * pSkeleton = "m=audio {port} RTP/AVP 0\r\n";
+    size_t partCount, messageLength;
+
+    result = SdpSerializer_CompileTemplate( &( sdpTemplate ), pSkeleton, strlen( pSkeleton ), placeholderNames, 1, parts, 2, &( partCount ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 1, serializerBuffer, sizeof( serializerBuffer ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_STRING( "m=audio 9 RTP/AVP 0\r\n", serializerBuffer );
+
+    result = SdpSerializer_RenderTemplate( &( sdpTemplate ), &( value ), 0, serializerBuffer, sizeof( serializerBuffer ), &( messageLength ) );
+    TEST_ASSERT_EQUAL( SDP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Generates SDP_ATTRIBUTE_NAME_HASH and attributeKindTable for
+source/sdp_deserializer.c.
+
+The hash is
+
+    ( length * L + name[ 0 ] * A + name[ 1 ] * B +
+      name[ length / 2 ] * C + name[ length - 1 ] * D ) & ( TABLE_SIZE - 1 )
+
+The names are read from the attributeNames table of sdp_deserializer.c.
+With --search, every ( L, A, B, C, D ) with coefficients in 1..31 is tried
+in order and the first one that gives each name its own slot is used. With
+--coefficients, the given values are checked instead. The script prints the
+macro and the table to paste into sdp_deserializer.c.
+
+Run it again whenever a name is added to attributeNames:
+
+    python3 tools/sdp_attribute_hash.py --coefficients 20,26,9,17,8
+    python3 tools/sdp_attribute_hash.py --search
+"""
+
+import argparse
+import itertools
+import os
+import re
+import sys
+
+TABLE_SIZE = 128
+MAX_COEFFICIENT = 31
+SOURCE = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), "..", "source", "sdp_deserializer.c" )
+
+
+def read_names( path ):
+    with open( path, newline = "" ) as source:
+        text = source.read()
+
+    table = re.search( r"attributeNames\[ SDP_ATTRIBUTE_KIND_COUNT \] =\s*\{(.*?)\};", text, re.S )
+
+    if table is None:
+        sys.exit( "attributeNames not found in " + path )
+
+    return re.findall( r'\{ "([^"]+)", \d+ \}', table.group( 1 ) )
+
+
+def name_hash( name, coefficients ):
+    l, a, b, c, d = coefficients
+    length = len( name )
+    value = ( length * l ) + ( ord( name[ 0 ] ) * a ) + ( ord( name[ 1 ] ) * b ) + \
+            ( ord( name[ length // 2 ] ) * c ) + ( ord( name[ length - 1 ] ) * d )
+
+    return value & ( TABLE_SIZE - 1 )
+
+
+def is_perfect( names, coefficients ):
+    slots = set()
+
+    for name in names:
+        slot = name_hash( name, coefficients )
+
+        if slot in slots:
+            return False
+
+        slots.add( slot )
+
+    return True
+
+
+def search( names ):
+    for coefficients in itertools.product( range( 1, MAX_COEFFICIENT + 1 ), repeat = 5 ):
+        if is_perfect( names, coefficients ):
+            return coefficients
+
+    return None
+
+
+def kind_name( name ):
+    return "SDP_ATTRIBUTE_KIND_" + name.upper().replace( "-", "_" )
+
+
+def print_output( names, coefficients ):
+    l, a, b, c, d = coefficients
+    table = [ "SDP_ATTRIBUTE_KIND_UNKNOWN" ] * TABLE_SIZE
+
+    for name in names:
+        table[ name_hash( name, coefficients ) ] = kind_name( name )
+
+    print( "#define SDP_ATTRIBUTE_NAME_HASH( pName, length )" )
+    print( "    ( ( ( ( length ) * %dU ) +" % l )
+    print( "        ( ( size_t ) ( uint8_t ) ( pName )[ 0 ] * %dU ) +" % a )
+    print( "        ( ( size_t ) ( uint8_t ) ( pName )[ 1 ] * %dU ) +" % b )
+    print( "        ( ( size_t ) ( uint8_t ) ( pName )[ ( length ) / 2U ] * %dU ) +" % c )
+    print( "        ( ( size_t ) ( uint8_t ) ( pName )[ ( length ) - 1U ] * %dU ) ) & %dU )" % ( d, TABLE_SIZE - 1 ) )
+    print( "" )
+    print( "static const uint8_t attributeKindTable[ %d ] =" % TABLE_SIZE )
+    print( "{" )
+
+    for row in range( 0, TABLE_SIZE, 4 ):
+        separator = "," if row + 4 < TABLE_SIZE else ""
+        print( "    " + ", ".join( table[ row:row + 4 ] ) + separator )
+
+    print( "};" )
+
+
+def main():
+    parser = argparse.ArgumentParser( description = "Generate the attribute name perfect hash." )
+    group = parser.add_mutually_exclusive_group( required = True )
+    group.add_argument( "--search", action = "store_true", help = "find the first collision free coefficients" )
+    group.add_argument( "--coefficients", help = "check the given L,A,B,C,D coefficients" )
+    parser.add_argument( "--source", default = SOURCE, help = "path of sdp_deserializer.c" )
+    args = parser.parse_args()
+
+    names = read_names( args.source )
+
+    if args.search:
+        coefficients = search( names )
+
+        if coefficients is None:
+            sys.exit( "No collision free coefficients; widen the search or grow TABLE_SIZE." )
+    else:
+        coefficients = tuple( int( value ) for value in args.coefficients.split( "," ) )
+
+        if ( len( coefficients ) != 5 ) or not is_perfect( names, coefficients ):
+            sys.exit( "The coefficients do not give each name its own slot." )
+
+    print_output( names, coefficients )
+
+
+if __name__ == "__main__":
+    main()